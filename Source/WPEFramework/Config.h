@@ -254,6 +254,37 @@ namespace PluginHost {
                 Core::JSON::Boolean OutputEnabled;
             };
 
+            class CompressionConfig : public Core::JSON::Container {
+            public:
+                CompressionConfig(const CompressionConfig&) = delete;
+                CompressionConfig& operator=(const CompressionConfig&) = delete;
+
+                CompressionConfig()
+                    : Core::JSON::Container()
+                    , WindowBits(15)
+                    , PeerWindowBits(15)
+                    , ContextTakeover(true)
+                    , PeerContextTakeover(true)
+                    , MemoryLevel(8)
+                    , MaxMessageSize(1024 * 1024)
+                {
+                    Add(_T("windowbits"), &WindowBits);
+                    Add(_T("peerwindowbits"), &PeerWindowBits);
+                    Add(_T("contexttakeover"), &ContextTakeover);
+                    Add(_T("peercontexttakeover"), &PeerContextTakeover);
+                    Add(_T("memorylevel"), &MemoryLevel);
+                    Add(_T("maxmessagesize"), &MaxMessageSize);
+                }
+                ~CompressionConfig() override = default;
+
+                Core::JSON::DecUInt8 WindowBits;
+                Core::JSON::DecUInt8 PeerWindowBits;
+                Core::JSON::Boolean ContextTakeover;
+                Core::JSON::Boolean PeerContextTakeover;
+                Core::JSON::DecUInt8 MemoryLevel;
+                Core::JSON::DecUInt32 MaxMessageSize;
+            };
+
 #ifdef PROCESSCONTAINERS_ENABLED
 
             class ProcessContainerConfig : public Core::JSON::Container {
@@ -315,10 +346,15 @@ namespace PluginHost {
                 , SoftKillCheckWaitTime(10)
                 , HardKillCheckWaitTime(4)
                 , IPV6(false)
+                , ResourceMonitors(1)
+                , MaxRequests(0)
+                , TokenCacheSize(16)
+                , TokenCacheTTL(30)
                 , DefaultMessagingCategories(false)
                 , DefaultWarningReportingCategories(false)
                 , Process()
                 , Input()
+                , Compression()
                 , Configs()
                 , EthernetCard()
                 , Environments()
@@ -350,6 +386,10 @@ namespace PluginHost {
                 Add(_T("softkillcheckwaittime"), &SoftKillCheckWaitTime);
                 Add(_T("hardkillcheckwaittime"), &HardKillCheckWaitTime);
                 Add(_T("ipv6"), &IPV6);
+                Add(_T("resourcemonitors"), &ResourceMonitors);
+                Add(_T("maxrequests"), &MaxRequests);
+                Add(_T("tokencachesize"), &TokenCacheSize);
+                Add(_T("tokencachettl"), &TokenCacheTTL);
 #ifdef __CORE_MESSAGING__
                 Add(_T("messaging"), &DefaultMessagingCategories);
 #else
@@ -359,6 +399,7 @@ namespace PluginHost {
                 Add(_T("redirect"), &Redirect);
                 Add(_T("process"), &Process);
                 Add(_T("input"), &Input);
+                Add(_T("compression"), &Compression);
                 Add(_T("plugins"), &Plugins);
                 Add(_T("configs"), &Configs);
                 Add(_T("ethernetcard"), &EthernetCard);
@@ -395,10 +436,15 @@ namespace PluginHost {
             Core::JSON::DecUInt8 SoftKillCheckWaitTime;
             Core::JSON::DecUInt8 HardKillCheckWaitTime;
             Core::JSON::Boolean IPV6;
+            Core::JSON::DecUInt8 ResourceMonitors;
+            Core::JSON::DecUInt8 MaxRequests;
+            Core::JSON::DecUInt16 TokenCacheSize;
+            Core::JSON::DecUInt16 TokenCacheTTL;
             Core::JSON::String DefaultMessagingCategories; 
             Core::JSON::String DefaultWarningReportingCategories; 
             ProcessSet Process;
             InputConfig Input;
+            CompressionConfig Compression;
             Core::JSON::String Configs;
             Core::JSON::String EthernetCard;
             Core::JSON::ArrayType<Plugin::Config> Plugins;
@@ -556,10 +602,16 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
             , _softKillCheckWaitTime(3)
             , _hardKillCheckWaitTime(10)
             , _stackSize(0)
+            , _resourceMonitors(1)
+            , _maxRequests(0)
+            , _tokenCacheSize(16)
+            , _tokenCacheTTL(30)
             , _latitude()
             , _longitude()
             , _messagingPort()
             , _inputInfo()
+            , _compression(false)
+            , _compressionSettings()
             , _processInfo()
             , _plugins()
             , _reasons()
@@ -601,7 +653,19 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 _interface = config.Interface.Value();
                 _portNumber = config.Port.Value();
                 _stackSize = config.Process.IsSet() ? config.Process.StackSize.Value() : 0;
+                _resourceMonitors = config.ResourceMonitors.Value();
+                _maxRequests = config.MaxRequests.Value();
+                _tokenCacheSize = config.TokenCacheSize.Value();
+                _tokenCacheTTL = config.TokenCacheTTL.Value();
                 _inputInfo.Set(config.Input);
+
+                _compression = config.Compression.IsSet();
+                _compressionSettings.WindowBits = config.Compression.WindowBits.Value();
+                _compressionSettings.PeerWindowBits = config.Compression.PeerWindowBits.Value();
+                _compressionSettings.ContextTakeover = config.Compression.ContextTakeover.Value();
+                _compressionSettings.PeerContextTakeover = config.Compression.PeerContextTakeover.Value();
+                _compressionSettings.MemoryLevel = config.Compression.MemoryLevel.Value();
+                _compressionSettings.MaxMessageSize = config.Compression.MaxMessageSize.Value();
                 _processInfo.Set(config.Process);
                 _ethernetCard = config.EthernetCard.Value();
                 _latitude = config.Latitude.Value();
@@ -799,6 +863,21 @@ POP_WARNING()
         inline uint32_t StackSize() const {
             return (_stackSize);
         }
+        inline uint8_t ResourceMonitors() const {
+            return (_resourceMonitors);
+        }
+        // Requests a single plugin may have in the thread pool, if the plugin does not say otherwise (0 is unlimited).
+        inline uint8_t MaxRequests() const {
+            return (_maxRequests);
+        }
+        // Number of tokens for which the resolved security officer is remembered (0 disables the cache).
+        inline uint16_t TokenCacheSize() const {
+            return (_tokenCacheSize);
+        }
+        // Seconds a resolved security officer is remembered for its token.
+        inline uint16_t TokenCacheTTL() const {
+            return (_tokenCacheTTL);
+        }
         inline string EthernetCard() const {
             return _ethernetCard;
         }
@@ -821,6 +900,13 @@ POP_WARNING()
             Core::SafeSyncType<Core::CriticalSection> scopedLock(_configLock);
             _longitude = newValue;
         }
+        // WebSockets accept permessage-deflate, if the compression section is configured.
+        inline bool IsCompressing() const {
+            return (_compression);
+        }
+        inline const Web::WebSocket::Deflate::Settings& Compression() const {
+            return (_compressionSettings);
+        }
         inline const InputInfo& Input() const {
             return(_inputInfo);
         }
@@ -986,10 +1072,16 @@ POP_WARNING()
         uint8_t _softKillCheckWaitTime;
         uint8_t _hardKillCheckWaitTime;
         uint32_t _stackSize;
+        uint8_t _resourceMonitors;
+        uint8_t _maxRequests;
+        uint16_t _tokenCacheSize;
+        uint16_t _tokenCacheTTL;
         int32_t _latitude;
         int32_t _longitude;
         uint16_t _messagingPort;
         InputInfo _inputInfo;
+        bool _compression;
+        Web::WebSocket::Deflate::Settings _compressionSettings;
         ProcessInfo _processInfo;
         Core::JSON::ArrayType<Plugin::Config> _plugins;
         std::list<PluginHost::IShell::reason> _reasons;
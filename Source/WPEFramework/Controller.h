@@ -351,6 +351,15 @@ POP_WARNING()
                 Core::JSON::DecUInt32 newElement;
                 data.ThreadPoolRuns.Add() = snapshot.Slot[teller];
             }
+
+            for (uint8_t lane = 0; lane < Core::ThreadPool::Priorities; lane++) {
+                data.Lanes.Add() = snapshot.Lane[lane];
+            }
+
+            uint32_t hits, misses;
+            _pluginServer->Services().TokenCache(hits, misses);
+            data.TokenHits = hits;
+            data.TokenMisses = misses;
 	}
         void Callstack(const ThreadId id, Core::JSON::ArrayType<CallstackData>& response) const;
         void SubSystems();
@@ -20,6 +20,9 @@ string(TOLOWER ${NAMESPACE} NAMESPACE_LIB)
 
 set(PORT 80 CACHE STRING "The port for the webinterface")
 set(BINDING "0.0.0.0" CACHE STRING "The binding interface")
+set(MAX_REQUESTS 0 CACHE STRING "Requests a single plugin may have in the workerpool (0 is unlimited)")
+set(TOKEN_CACHE_SIZE 16 CACHE STRING "Tokens for which the resolved security officer is remembered (0 disables the cache)")
+set(TOKEN_CACHE_TTL 30 CACHE STRING "Seconds a resolved security officer is remembered")
 set(IDLE_TIME 180 CACHE STRING "Idle time")
 set(SOFT_KILL_CHECK_WAIT_TIME 10  CACHE STRING "Soft kill check waiting time")
 set(HARD_KILL_CHECK_WAIT_TIME 4  CACHE STRING "Hard kill check waiting time")
@@ -32,6 +35,7 @@ set(PROXYSTUB_PATH "${CMAKE_INSTALL_PREFIX}/lib/${NAMESPACE_LIB}/proxystubs" CAC
 set(POSTMORTEM_PATH "/opt/minidumps" CACHE STRING "Core file path to do the postmortem of the crash")
 set(CONFIG_INSTALL_PATH "/etc/${NAMESPACE}" CACHE STRING "Install location of the configuration")
 set(IPV6_SUPPORT false CACHE STRING "Controls if should application supports ipv6")
+set(RESOURCE_MONITORS 1 CACHE STRING "Number of threads monitoring the sockets and other resources")
 set(PRIORITY 0 CACHE STRING "Change the nice level [-20 - 20]")
 set(POLICY "OTHER" CACHE STRING "NA")
 set(OOMADJUST 0 CACHE STRING "Adapt the OOM score [-15 - 15]")
@@ -57,7 +61,11 @@ ans(CONFIG)
 map_set(${CONFIG} port ${PORT})
 map_set(${CONFIG} binding ${BINDING})
 map_set(${CONFIG} ipv6 ${IPV6_SUPPORT})
+map_set(${CONFIG} resourcemonitors ${RESOURCE_MONITORS})
 map_set(${CONFIG} idletime ${IDLE_TIME})
+map_set(${CONFIG} maxrequests ${MAX_REQUESTS})
+map_set(${CONFIG} tokencachesize ${TOKEN_CACHE_SIZE})
+map_set(${CONFIG} tokencachettl ${TOKEN_CACHE_TTL})
 map_set(${CONFIG} softkillcheckwaittime ${SOFT_KILL_CHECK_WAIT_TIME})
 map_set(${CONFIG} hardkillcheckwaittime ${HARD_KILL_CHECK_WAIT_TIME})
 map_set(${CONFIG} persistentpath ${PERSISTENT_PATH})
@@ -507,6 +507,11 @@ POP_WARNING()
                 myself.Policy(_config->Process().Policy());
             }
 
+            if (_config->ResourceMonitors() > 1) {
+                // Spread the socket handling over multiple threads, before anything gets registered.
+                Core::ResourceMonitor::Instance().Monitors(_config->ResourceMonitors());
+            }
+
             // Time to start loading the config of the plugins.
             string pluginPath(_config->ConfigsPath());
 
@@ -801,6 +806,11 @@ POP_WARNING()
                                 printf(" [%s]\n", metaData.Slot[index].Job.Value().c_str());
                             }
                         }
+                        printf("Lanes:\n");
+                        for (uint8_t index = 0; index < Core::ThreadPool::Priorities; index++) {
+                            const Core::ThreadPool::LaneMetadata& lane(metaData.Lane[index]);
+                            printf("  %-8s: %5d pending, %10d dispatched, wait %d us avg, %d us max\n", Core::EnumerateType<Core::ThreadPool::priority>(lane.Lane).Data(), lane.Pending, lane.Dispatched, lane.AverageWait, lane.MaximumWait);
+                        }
                         status->Release();
                         break;
                     }
@@ -814,6 +824,10 @@ POP_WARNING()
                         printf("============================================================\n");
                         Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
                         printf("Currently monitoring: %d resources\n", monitor.Count());
+                        printf("Monitor threads:      %d\n", monitor.Monitors());
+                        printf("Monitor runs:         %d\n", monitor.Runs());
+                        printf("Wakeups:              %d (requested %d)\n", monitor.Wakeups(), monitor.WakeupRequests());
+                        printf("I/O events:           %d\n", monitor.IOEvents());
                         uint32_t index = 0;
                         Core::ResourceMonitor::Metadata info;
 
@@ -234,6 +234,11 @@ namespace PluginHost
             index = _services.erase(index);
         }
 
+        Publish();
+
+        // Do not keep the officers of the security plugin alive, it is about to be deactivated.
+        _officers.Clear();
+
         _adminLock.Unlock();
 
         TRACE_L1("Destructing %d plugins.", static_cast<uint32_t>(_services.size()));
@@ -725,6 +730,10 @@ namespace PluginHost
         , _requestClose(false)
     {
         TRACE(Activity, (_T("Construct a link with ID: [%d] to [%s]"), Id(), remoteId.QualifiedName().c_str()));
+
+        if (_parent.Configuration().IsCompressing() == true) {
+            Compression(_parent.Configuration().Compression());
+        }
     }
 
     /* virtual */ Server::Channel::~Channel()
@@ -752,6 +761,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         , _connections(*this, configuration.Binder(), configuration.IdleTime())
         , _config(configuration)
         , _services(*this, _config)
+        , _throttle(*this, THREADPOOL_COUNT)
         , _controller()
         , _factoriesImplementation()
     {
@@ -884,6 +884,11 @@ namespace PluginHost {
                 }
                 _pluginHandling.Unlock();
 
+                uint32_t executing, queued;
+                _administrator.Requests(Callsign(), executing, queued);
+                metaData.Executing = executing;
+                metaData.Queued = queued;
+
                 PluginHost::Service::GetMetaData(metaData);
             }
             inline void Evaluate()
@@ -1888,6 +1893,182 @@ POP_WARNING()
                 Core::ThreadPool::JobType<Job> _job;
             };
 
+            // Every request resolves its callsign (or "callsign.version") through this table. Request threads read it
+            // without locking, it is rebuilt and republished as a whole, whenever a plugin is added or removed.
+            class Routes {
+            public:
+                Routes() = delete;
+                Routes(const Routes&) = delete;
+                Routes& operator=(const Routes&) = delete;
+
+                Routes(const std::map<const string, Core::ProxyType<Service>>& services)
+                    : _table(services.begin(), services.end())
+                {
+                }
+                ~Routes() = default;
+
+            public:
+                uint32_t Find(const string& callSign, Core::ProxyType<Service>& service) const
+                {
+                    uint32_t result = Core::ERROR_UNAVAILABLE;
+
+                    std::unordered_map<string, Core::ProxyType<Service>>::const_iterator index(_table.find(callSign));
+
+                    if (index != _table.end()) {
+                        // Service found, did not requested specific version
+                        service = index->second;
+                        result = Core::ERROR_NONE;
+                    } else {
+                        // Perhaps a specific version was requested (callsign.version).
+                        size_t length = callSign.find_last_of('.');
+
+                        while ((length != string::npos) && (length > 0)) {
+                            index = _table.find(callSign.substr(0, length));
+
+                            if (index != _table.end()) {
+                                if (index->second->HasVersionSupport(callSign.substr(length + 1)) == true) {
+                                    // Requested version of service is supported!
+                                    service = index->second;
+                                    result = Core::ERROR_NONE;
+                                } else {
+                                    // Requested version is not supported
+                                    result = Core::ERROR_INVALID_SIGNATURE;
+                                }
+                                break;
+                            }
+
+                            length = callSign.find_last_of('.', length - 1);
+                        }
+                    }
+
+                    return (result);
+                }
+
+            private:
+                const std::unordered_map<string, Core::ProxyType<Service>> _table;
+            };
+
+            // Resolving a token to its security officer, often is a COM-RPC round trip to the security plugin. Officers
+            // resolved recently are remembered for a while. Should be used with the _adminLock taken.
+            class Officers {
+            private:
+                class Entry {
+                public:
+                    Entry() = delete;
+                    Entry(const Entry&) = delete;
+                    Entry& operator=(const Entry&) = delete;
+
+                    Entry(ISecurity* officer, const uint64_t expiry)
+                        : Officer(officer)
+                        , Expiry(expiry)
+                    {
+                        Officer->AddRef();
+                    }
+                    ~Entry()
+                    {
+                        Officer->Release();
+                    }
+
+                public:
+                    ISecurity* const Officer;
+                    const uint64_t Expiry;
+                };
+
+                using Cache = std::unordered_map<string, Entry>;
+
+            public:
+                Officers() = delete;
+                Officers(const Officers&) = delete;
+                Officers& operator=(const Officers&) = delete;
+
+                Officers(const uint16_t size, const uint16_t ttl)
+                    : _cache()
+                    , _size(size)
+                    , _ttl(static_cast<uint64_t>(ttl) * Core::Time::MilliSecondsPerSecond * Core::Time::TicksPerMillisecond)
+                    , _hits(0)
+                    , _misses(0)
+                {
+                }
+                ~Officers() = default;
+
+            public:
+                // Returns the (AddRef'ed) officer for this token, if we still know it.
+                ISecurity* Find(const string& token)
+                {
+                    ISecurity* result = nullptr;
+
+                    if (_size > 0) {
+                        Cache::iterator index(_cache.find(token));
+
+                        if ((index != _cache.end()) && (index->second.Expiry > Core::Time::Now().Ticks())) {
+                            result = index->second.Officer;
+                            result->AddRef();
+                            _hits++;
+                        } else {
+                            if (index != _cache.end()) {
+                                _cache.erase(index);
+                            }
+                            _misses++;
+                        }
+                    }
+
+                    return (result);
+                }
+                void Add(const string& token, ISecurity* officer)
+                {
+                    ASSERT(officer != nullptr);
+
+                    if (_size > 0) {
+                        const uint64_t now = Core::Time::Now().Ticks();
+
+                        if (_cache.size() >= _size) {
+                            Cache::iterator oldest(_cache.end());
+                            Cache::iterator index(_cache.begin());
+
+                            // Make room, drop what expired, if nothing did, the one that expires first.
+                            while (index != _cache.end()) {
+                                if (index->second.Expiry <= now) {
+                                    index = _cache.erase(index);
+                                } else {
+                                    if ((oldest == _cache.end()) || (index->second.Expiry < oldest->second.Expiry)) {
+                                        oldest = index;
+                                    }
+                                    index++;
+                                }
+                            }
+
+                            if ((_cache.size() >= _size) && (oldest != _cache.end())) {
+                                _cache.erase(oldest);
+                            }
+                        }
+
+                        _cache.erase(token);
+                        _cache.emplace(std::piecewise_construct,
+                            std::forward_as_tuple(token),
+                            std::forward_as_tuple(officer, now + _ttl));
+                    }
+                }
+                void Clear()
+                {
+                    _cache.clear();
+                }
+                uint32_t Hits() const
+                {
+                    return (_hits);
+                }
+                uint32_t Misses() const
+                {
+                    return (_misses);
+                }
+
+            private:
+                Cache _cache;
+                const uint16_t _size;
+                const uint64_t _ttl;
+                uint32_t _hits;
+                uint32_t _misses;
+            };
+
         public:
             ServiceMap() = delete;
             ServiceMap(const ServiceMap&) = delete;
@@ -1917,6 +2098,10 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _server(server)
                 , _subSystems(this)
                 , _authenticationHandler(nullptr)
+                , _officers(config.TokenCacheSize(), config.TokenCacheTTL())
+                , _routes(new Routes(_services))
+                , _generation(0)
+                , _readers{ {0}, {0} }
             {
             }
 POP_WARNING()
@@ -1924,6 +2109,8 @@ POP_WARNING()
             {
                 // Make sure all services are deactivated before we are killed (call Destroy on this object);
                 ASSERT(_services.size() == 0);
+
+                delete _routes.load();
             }
 
         public:
@@ -1932,6 +2119,9 @@ POP_WARNING()
                 _adminLock.Lock();
 
                 if ((_authenticationHandler == nullptr) ^ (enabled == false)) {
+                    // Whatever the officers were, they are no longer the ones to ask.
+                    _officers.Clear();
+
                     if (_authenticationHandler == nullptr) {
                         // Let get the AuthentcationHandler.
                         _authenticationHandler = reinterpret_cast<IAuthenticate*>(QueryInterfaceByCallsign(IAuthenticate::ID, _subSystems.SecurityCallsign()));
@@ -1950,7 +2140,15 @@ POP_WARNING()
                 _adminLock.Lock();
 
                 if (_authenticationHandler != nullptr) {
-                    result = _authenticationHandler->Officer(token);
+                    result = _officers.Find(token);
+
+                    if (result == nullptr) {
+                        result = _authenticationHandler->Officer(token);
+
+                        if (result != nullptr) {
+                            _officers.Add(token, result);
+                        }
+                    }
                 } else {
                     result = _webbridgeConfig.Security();
                 }
@@ -1958,6 +2156,13 @@ POP_WARNING()
                 _adminLock.Unlock();
                 return (result);
             }
+            inline void TokenCache(uint32_t& hits, uint32_t& misses) const
+            {
+                _adminLock.Lock();
+                hits = _officers.Hits();
+                misses = _officers.Misses();
+                _adminLock.Unlock();
+            }
             inline uint32_t Submit(const uint32_t id, const Core::ProxyType<Core::JSON::IElement>& response)
             {
                 return (_server.Dispatcher().Submit(id, response));
@@ -2121,6 +2326,8 @@ POP_WARNING()
                     // Fire up the interface. Let it handle the messages.
                     _services.insert(std::pair<const string, Core::ProxyType<Service>>(configuration.Callsign.Value(), newService));
 
+                    Publish();
+
                     _adminLock.Unlock();
                 }
 
@@ -2145,6 +2352,8 @@ POP_WARNING()
                         // Fire up the interface. Let it handle the messages.
                         _services.insert(std::pair<const string, Core::ProxyType<Service>>(newConfiguration.Callsign.Value(), newService));
 
+                        Publish();
+
                         newService->Evaluate();
 
                         result = Core::ERROR_NONE;
@@ -2165,6 +2374,8 @@ POP_WARNING()
                 if (index != _services.end()) {
                     index->second->Destroy();
                     _services.erase(index);
+
+                    Publish();
                 }
 
                 _adminLock.Unlock();
@@ -2204,38 +2415,30 @@ POP_WARNING()
                     duplicates.pop_front();
                 }
             }
-            uint32_t FromIdentifier(const string& callSign, Core::ProxyType<Service>& service)
+            void Requests(const string& callsign, uint32_t& executing, uint32_t& queued) const
             {
-                uint32_t result = Core::ERROR_UNAVAILABLE;
+                _server._throttle.Info(callsign, executing, queued);
+            }
+            uint32_t FromIdentifier(const string& callSign, Core::ProxyType<Service>& service) const
+            {
+                // Announce ourselves as a reader of the current generation, if it did not move on in the mean time,
+                // the table that is published now can not be deleted until we are done with it.
+                uint32_t generation;
 
-                _adminLock.Lock();
+                do {
+                    generation = _generation.load();
+                    _readers[generation & 1]++;
 
-                for (auto index : _services) {
-                    const string& source(index.first);
-                    uint32_t length = static_cast<uint32_t>(source.length());
-
-                    if (callSign.compare(0, source.length(), source) == 0) {
-                        if (callSign.length() == length) {
-                            // Service found, did not requested specific version
-                            service = index.second;
-                            result = Core::ERROR_NONE;
-                            break;
-                        } else if (callSign[length] == '.') {
-                            // Requested specific version of a plugin
-                            if (index.second->HasVersionSupport(callSign.substr(length + 1)) == true) {
-                                // Requested version of service is supported!
-                                service = index.second;
-                                result = Core::ERROR_NONE;
-                            } else {
-                                // Requested version is not supported
-                                result = Core::ERROR_INVALID_SIGNATURE;
-                            }
-                            break;
-                        }
+                    if (_generation.load() == generation) {
+                        break;
                     }
-                }
 
-                _adminLock.Unlock();
+                    _readers[generation & 1]--;
+                } while (true);
+
+                uint32_t result = _routes.load()->Find(callSign, service);
+
+                _readers[generation & 1]--;
 
                 return (result);
             }
@@ -2249,6 +2452,19 @@ POP_WARNING()
             }
 
         private:
+            // Should be called with the _adminLock taken, after _services changed.
+            void Publish()
+            {
+                Routes* old = _routes.exchange(new Routes(_services));
+                uint32_t generation = _generation++;
+
+                // Readers that might still be looking at the old table, have announced themselves in the old generation.
+                while (_readers[generation & 1].load() != 0) {
+                    std::this_thread::yield();
+                }
+
+                delete old;
+            }
             void Remove(const string& connector) const
             {
                 // This is already locked by the callee, so safe to operate on the map..
@@ -2326,6 +2542,202 @@ POP_WARNING()
             Server& _server;
             Core::Sink<SubSystems> _subSystems;
             IAuthenticate* _authenticationHandler;
+            Officers _officers;
+            std::atomic<Routes*> _routes;
+            std::atomic<uint32_t> _generation;
+            mutable std::atomic<uint32_t> _readers[2];
+        };
+
+        // A single plugin should not be able to claim all threads of the workerpool. Each plugin
+        // can have a limited number of requests executing, whatever comes in on top of that is
+        // parked here and released, round-robin over the plugins waiting, as soon as slots free up.
+        class Throttle {
+        private:
+            using Jobs = std::list< std::pair<Core::ProxyType<Core::IDispatch>, Core::ThreadPool::priority> >;
+
+            class Bucket {
+            public:
+                Bucket() = delete;
+                Bucket(const Bucket&) = delete;
+                Bucket& operator=(const Bucket&) = delete;
+
+                Bucket(const uint32_t limit)
+                    : Executing(0)
+                    , Limit(limit)
+                    , Pending()
+                    , Waiting(false)
+                {
+                }
+                ~Bucket() = default;
+
+            public:
+                uint32_t Executing;
+                const uint32_t Limit;
+                Jobs Pending;
+                bool Waiting;
+            };
+
+            using Buckets = std::map<const string, Bucket>;
+
+        public:
+            Throttle() = delete;
+            Throttle(const Throttle&) = delete;
+            Throttle& operator=(const Throttle&) = delete;
+
+            Throttle(Server& parent, const uint32_t slots)
+                : _adminLock()
+                , _parent(parent)
+                , _buckets()
+                , _ring()
+                , _executing(0)
+                , _slots(slots)
+            {
+            }
+            ~Throttle()
+            {
+                _ring.clear();
+                _buckets.clear();
+            }
+
+        public:
+            void Submit(const string& callsign, const Core::ProxyType<Core::IDispatch>& job, const Core::ThreadPool::priority lane)
+            {
+                _adminLock.Lock();
+
+                Buckets::iterator index(_buckets.find(callsign));
+
+                if (index == _buckets.end()) {
+                    // Looking up the limit takes the ServiceMap lock, do not nest it in ours.
+                    _adminLock.Unlock();
+
+                    uint32_t limit = Limit(callsign);
+
+                    _adminLock.Lock();
+
+                    index = _buckets.emplace(std::piecewise_construct,
+                        std::forward_as_tuple(callsign),
+                        std::forward_as_tuple(limit)).first;
+                }
+
+                Bucket& bucket(index->second);
+
+                // Critical work (the Controller) is never held back, it is only accounted for.
+                if ((lane == Core::ThreadPool::CRITICAL) || ((bucket.Pending.empty() == true) && (bucket.Executing < bucket.Limit) && (_executing < _slots))) {
+                    bucket.Executing++;
+                    _executing++;
+
+                    _adminLock.Unlock();
+
+                    _parent._dispatcher.Submit(job, lane);
+                } else {
+                    bucket.Pending.emplace_back(job, lane);
+
+                    if (bucket.Waiting == false) {
+                        bucket.Waiting = true;
+                        _ring.push_back(index);
+                    }
+
+                    _adminLock.Unlock();
+                }
+            }
+            void Completed(const string& callsign)
+            {
+                Jobs ready;
+
+                _adminLock.Lock();
+
+                Buckets::iterator index(_buckets.find(callsign));
+
+                ASSERT(index != _buckets.end());
+
+                if (index != _buckets.end()) {
+                    ASSERT(index->second.Executing > 0);
+                    ASSERT(_executing > 0);
+
+                    index->second.Executing--;
+                    _executing--;
+
+                    if ((index->second.Executing == 0) && (index->second.Waiting == false)) {
+                        _buckets.erase(index);
+                    }
+                }
+
+                // Hand out the free slots, one request per plugin per round.
+                std::list<Buckets::iterator>::iterator loop(_ring.begin());
+
+                while ((_executing < _slots) && (loop != _ring.end())) {
+                    Bucket& bucket((*loop)->second);
+
+                    if (bucket.Executing >= bucket.Limit) {
+                        loop++;
+                    } else {
+                        ready.push_back(bucket.Pending.front());
+                        bucket.Pending.pop_front();
+                        bucket.Executing++;
+                        _executing++;
+
+                        Buckets::iterator entry(*loop);
+                        loop = _ring.erase(loop);
+
+                        if (bucket.Pending.empty() == true) {
+                            bucket.Waiting = false;
+                        } else {
+                            // Go to the back of the line, give the others a chance first.
+                            _ring.push_back(entry);
+                        }
+
+                        if (loop == _ring.end()) {
+                            loop = _ring.begin();
+                        }
+                    }
+                }
+
+                _adminLock.Unlock();
+
+                for (const std::pair<Core::ProxyType<Core::IDispatch>, Core::ThreadPool::priority>& entry : ready) {
+                    _parent._dispatcher.Submit(entry.first, entry.second);
+                }
+            }
+            void Info(const string& callsign, uint32_t& executing, uint32_t& queued) const
+            {
+                _adminLock.Lock();
+
+                Buckets::const_iterator index(_buckets.find(callsign));
+
+                if (index == _buckets.end()) {
+                    executing = 0;
+                    queued = 0;
+                } else {
+                    executing = index->second.Executing;
+                    queued = static_cast<uint32_t>(index->second.Pending.size());
+                }
+
+                _adminLock.Unlock();
+            }
+
+        private:
+            uint32_t Limit(const string& callsign) const
+            {
+                uint32_t limit = 0;
+                Core::ProxyType<Service> service;
+
+                if (_parent._services.FromIdentifier(callsign, service) == Core::ERROR_NONE) {
+                    limit = service->PluginHost::Service::Configuration().MaxRequests.Value();
+                }
+                if (limit == 0) {
+                    limit = _parent._config.MaxRequests();
+                }
+
+                return (limit == 0 ? Core::NumberType<uint32_t>::Max() : limit);
+            }
+
+        private:
+            mutable Core::CriticalSection _adminLock;
+            Server& _parent;
+            Buckets _buckets;
+            std::list<Buckets::iterator> _ring;
+            uint32_t _executing;
+            const uint32_t _slots;
         };
 
         // Connection handler is the listening socket and keeps track of all open
@@ -2343,6 +2755,7 @@ POP_WARNING()
                     : _ID(~0)
                     , _server(nullptr)
                     , _service()
+                    , _target()
                 {
                 }
                 ~Job() override
@@ -2369,6 +2782,17 @@ POP_WARNING()
                     if (_service.IsValid() == true) {
                         _service.Release();
                     }
+                    if (_target.empty() == false) {
+                        // Free up our slot, this might release the next request of this, or another, plugin.
+                        string target(_target);
+                        _target.clear();
+                        _server->Completed(target);
+                    }
+                }
+                void Target(const string& callsign)
+                {
+                    ASSERT(_target.empty() == true);
+                    _target = callsign;
                 }
                 void Set(const uint32_t id, Server* server, Core::ProxyType<Service>& service)
                 {
@@ -2423,6 +2847,7 @@ POP_WARNING()
                 uint32_t _ID;
                 Server* _server;
                 Core::ProxyType<Service> _service;
+                string _target;
             };
             class WebRequestJob : public Job {
             public:
@@ -2892,7 +3317,7 @@ POP_WARNING()
                         if (job.IsValid() == true) {
                             Core::ProxyType<Web::Request> baseRequest(request);
                             job->Set(Id(), &_parent, service, baseRequest, _security->Token(), !request->ServiceCall());
-                            _parent.Submit(Core::ProxyType<Core::IDispatch>(job));
+                            Execute(service->Callsign(), job);
                         }
                     }
                     break;
@@ -2965,8 +3390,17 @@ POP_WARNING()
                     ASSERT(job.IsValid() == true);
 
                     if ((_service.IsValid() == true) && (job.IsValid() == true)) {
+                        string callsign;
+
+                        if ((State() & Channel::JSONRPC) != 0) {
+                            Core::ProxyType<Core::JSONRPC::Message> message(element);
+                            if (message.IsValid() == true) {
+                                callsign = message->Callsign();
+                            }
+                        }
+
                         job->Set(Id(), &_parent, _service, element, _security->Token(), ((State() & Channel::JSONRPC) != 0));
-                        _parent.Submit(Core::ProxyType<Core::IDispatch>(job));
+                        Execute(callsign.empty() == true ? _service->Callsign() : callsign, job);
                     }
                 }
             }
@@ -2984,7 +3418,7 @@ POP_WARNING()
 
                 if ((_service.IsValid() == true) && (job.IsValid() == true)) {
                     job->Set(Id(), &_parent, _service, value);
-                    _parent.Submit(Core::ProxyType<Core::IDispatch>(job));
+                    Execute(_service->Callsign(), job);
                 }
             }
 
@@ -3091,12 +3525,31 @@ POP_WARNING()
                     } else if (protocol == _T("jsonrpc")) {
                         State(JSONRPC, false);
                         return protocol;
+                    } else if (protocol == _T("json.msgpack")) {
+                        State(JSON, false);
+                        MessagePack(true);
+                        return protocol;
+                    } else if (protocol == _T("jsonrpc.msgpack")) {
+                        State(JSONRPC, false);
+                        MessagePack(true);
+                        return protocol;
                     }
                 }
 
                 State(RAW, false);
                 return _T("");
             }
+            // Controller requests (activation, deactivation, ...) should not queue up behind plugin traffic.
+            inline Core::ThreadPool::priority Lane(const string& callsign) const
+            {
+                return (callsign == _parent.Controller()->Callsign() ? Core::ThreadPool::CRITICAL : Core::ThreadPool::NORMAL);
+            }
+            template <typename JOB>
+            inline void Execute(const string& callsign, Core::ProxyType<JOB>& job)
+            {
+                job->Target(callsign);
+                _parent._throttle.Submit(callsign, Core::ProxyType<Core::IDispatch>(job), Lane(callsign));
+            }
 
             Server& _parent;
             PluginHost::ISecurity* _security;
@@ -3274,9 +3727,9 @@ POP_WARNING()
         {
             return (_dispatcher);
         }
-        inline void Submit(const Core::ProxyType<Core::IDispatch>& job)
+        inline void Submit(const Core::ProxyType<Core::IDispatch>& job, const Core::ThreadPool::priority lane = Core::ThreadPool::NORMAL)
         {
-            _dispatcher.Submit(job);
+            _dispatcher.Submit(job, lane);
         }
         inline void Schedule(const uint64_t time, const Core::ProxyType<Core::IDispatch>& job)
         {
@@ -3331,6 +3784,9 @@ POP_WARNING()
         void Closed(const uint32_t id) {
             _services.Closed(id);
         }
+        void Completed(const string& callsign) {
+            _throttle.Completed(callsign);
+        }
 
     private:
         Core::NodeId _accessor;
@@ -3349,6 +3805,9 @@ POP_WARNING()
         // Maintain a list of all the loaded plugin servers. Here we can dispatch work to.
         ServiceMap _services;
 
+        // Keeps a single plugin from claiming all threads of the _dispatcher.
+        Throttle _throttle;
+
         PluginHost::InputHandler _inputHandler;
 
         // Hold on to the controller that controls the PluginHost. Using this plugin, the
@@ -25,10 +25,12 @@ namespace RPC {
 
     Administrator::Administrator()
         : _adminLock()
+        , _referenceLock()
         , _stubs()
         , _proxy()
         , _factory(8)
         , _channelProxyMap()
+        , _channelReferenceMap()
     {
     }
 
@@ -109,11 +111,12 @@ namespace RPC {
         ChannelMap::iterator index(_channelProxyMap.find(proxy.Channel().operator->()));
 
         if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && ((*entry) != &proxy)) {
+            std::pair<ProxyList::iterator, ProxyList::iterator> range(index->second.equal_range(ProxyKey(proxy.Implementation(), proxy.InterfaceId())));
+            ProxyList::iterator entry(range.first);
+            while ((entry != range.second) && (entry->second != &proxy)) {
                 entry++;
             }
-            if (entry != index->second.end()) {
+            if (entry != range.second) {
                 index->second.erase(entry);
                 if (index->second.size() == 0) {
                     _channelProxyMap.erase(index);
@@ -152,14 +155,11 @@ namespace RPC {
         ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
 
         if (index != _channelProxyMap.end()) {
-            ProxyList::iterator entry(index->second.begin());
-            while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
-                entry++;
-            }
-            if (entry != index->second.end()) {
-                interface = (*entry)->QueryInterface(id);
+            std::pair<ProxyList::iterator, ProxyList::iterator> range(index->second.equal_range(ProxyKey(impl, id)));
+            if (range.first != range.second) {
+                interface = range.first->second->QueryInterface(id);
                 if (interface != nullptr) {
-                    result = (*entry);
+                    result = range.first->second;
                 }
             }
         }
@@ -182,19 +182,17 @@ namespace RPC {
             ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
 
             if (index != _channelProxyMap.end()) {
-                ProxyList::iterator entry(index->second.begin());
-                while ((entry != index->second.end()) && (((*entry)->InterfaceId() != id) || ((*entry)->Implementation() != impl))) {
+                std::pair<ProxyList::iterator, ProxyList::iterator> range(index->second.equal_range(ProxyKey(impl, id)));
+                ProxyList::iterator entry(range.first);
+
+                // The proxy could be found, but it might be on its way out (released but not yet unregistered). If
+                // that is the case, the interface == nullptr and we still need to create a proxy for this specific
+                // interface, unless another one for the same implementation is still alive.
+                while ((entry != range.second) && ((interface = entry->second->Aquire(outbound, id)) == nullptr)) {
                     entry++;
                 }
-                if (entry != index->second.end()) {
-                    interface = (*entry)->Aquire(outbound, id);
-
-                    // The implementation could be found, but the current implemented proxy is not
-                    // for the given interface. If that cae, the interface == nullptr and we still 
-                    // need to create a proxy for this specific interface.
-                    if (interface != nullptr) {
-                        result = (*entry);
-                    }
+                if (entry != range.second) {
+                    result = entry->second;
                 }
             }
 
@@ -208,7 +206,7 @@ namespace RPC {
                     ASSERT(result != nullptr);
 
                     // Register it as it is remotely registered :-)
-                    _channelProxyMap[channel.operator->()].push_back(result);
+                    _channelProxyMap[channel.operator->()].emplace(ProxyKey(impl, id), result);
 
                     // This will increment the reference count to 1.
                     interface = result->QueryInterface(id);
@@ -227,48 +225,34 @@ namespace RPC {
     void Administrator::RegisterUnknownInterface(Core::ProxyType<Core::IPCChannel>& channel, Core::IUnknown* reference, const uint32_t id)
     {
         if (reference != nullptr) {
-            _adminLock.Lock();
+            _referenceLock.Lock();
 
-            ReferenceMap::iterator index = _channelReferenceMap.find(channel.operator->());
+            // See that it does not already exists on this channel, no need to register it again!!!
+            RecoveryList& references(_channelReferenceMap[channel.operator->()]);
+            RecoverySet* element(references.Find(reference, id));
 
-            if (index == _channelReferenceMap.end()) {
-                auto result = _channelReferenceMap.emplace(std::piecewise_construct,
-                    std::forward_as_tuple(channel.operator->()),
-                    std::forward_as_tuple());
-                result.first->second.emplace_back(id, reference);
+            if (element == nullptr) {
+                // Add this element to the list. We are referencing it now with a proxy on the other side..
+                references.Add(reference, id);
             } else {
-                // See that it does not already exists on this channel, no need to register
-                // it again!!!
-                std::list< RecoverySet >::iterator element(index->second.begin());
-
-                while ( (element != index->second.end()) && ((element->Id() != id) || (element->Unknown() != reference)) ) {
-                    element++;
-                }
-
-                if (element == index->second.end()) {
-                    // Add this element to the list. We are referencing it now with a proxy on the other side..
-                    index->second.emplace_back(id, reference);
-                }
-                else {
-                    // If this happens, it means that the interface we are trying to register, is already handed out, over the same channel.
-                    // This means, that on the otherside (the receiving side) that will create a Proxy for this interface, finds this interface as well.
-                    // Now two things can happen:
-                    // 1) Everything is stable, when this call arrives on the otherside, the proxy is found, and the externalReferenceCount (the number 
-                    //    of AddRefs the RemoteSide has on this Real Object is incremented by one).
-                    // 2) Corner case, unlikely top happen, but we need to cater for it. If during the return of this reference, that Proxy on the otherside
-                    //    might reach the reference 0. That will, on that side, clear out the proxy. That will send a Release for that proxy to this side and
-                    //    that release will not kill the "real" object here becasue we have still a reference on the real object for this interface. When this 
-                    //    interface reaches the other side, it will simply create a new proxy with an externalReference COunt of 1.
-                    //
-                    // However, if the connection dies and scenario 2 took place, and we did *not* reference count this cleanup map, this reference for the newly 
-                    // created proxy in step 2, is in case of a crash never released!!! So to avoid this scenario, we should also reference count the cleanup map 
-                    // interface entry here, than we are good to go, as long as the "dropReleases" count also ends up here :-)
-                    TRACE_L1("The Proxy is existing on the otherside, no need ");
-                    element->Increment();
-                }
+                // If this happens, it means that the interface we are trying to register, is already handed out, over the same channel.
+                // This means, that on the otherside (the receiving side) that will create a Proxy for this interface, finds this interface as well.
+                // Now two things can happen:
+                // 1) Everything is stable, when this call arrives on the otherside, the proxy is found, and the externalReferenceCount (the number 
+                //    of AddRefs the RemoteSide has on this Real Object is incremented by one).
+                // 2) Corner case, unlikely top happen, but we need to cater for it. If during the return of this reference, that Proxy on the otherside
+                //    might reach the reference 0. That will, on that side, clear out the proxy. That will send a Release for that proxy to this side and
+                //    that release will not kill the "real" object here becasue we have still a reference on the real object for this interface. When this 
+                //    interface reaches the other side, it will simply create a new proxy with an externalReference COunt of 1.
+                //
+                // However, if the connection dies and scenario 2 took place, and we did *not* reference count this cleanup map, this reference for the newly 
+                // created proxy in step 2, is in case of a crash never released!!! So to avoid this scenario, we should also reference count the cleanup map 
+                // interface entry here, than we are good to go, as long as the "dropReleases" count also ends up here :-)
+                TRACE_L1("The Proxy is existing on the otherside, no need ");
+                element->Increment();
             }
 
-            _adminLock.Unlock();
+            _referenceLock.Unlock();
         }
     }
 
@@ -280,12 +264,12 @@ namespace RPC {
 
     void Administrator::DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies)
     {
-        _adminLock.Lock();
+        _referenceLock.Lock();
 
         ReferenceMap::iterator remotes(_channelReferenceMap.find(channel.operator->()));
 
         if (remotes != _channelReferenceMap.end()) {
-            std::list<RecoverySet>::iterator loop(remotes->second.begin());
+            auto loop(remotes->second.begin());
             while (loop != remotes->second.end()) {
                 uint32_t result = Core::ERROR_NONE;
 
@@ -307,6 +291,10 @@ namespace RPC {
             _channelReferenceMap.erase(remotes);
         }
 
+        _referenceLock.Unlock();
+
+        _adminLock.Lock();
+
         ChannelMap::iterator index(_channelProxyMap.find(channel.operator->()));
 
         if (index != _channelProxyMap.end()) {
@@ -316,8 +304,8 @@ namespace RPC {
                 // interface is released in the same time before we report this interface
                 // to be dead. So lets keep a refernce so we can work on a real object
                 // still. This race condition, was observed by customer testing.
-                if ((*loop)->Invalidate() == true) {
-                    pendingProxies.push_back(*loop);
+                if (loop->second->Invalidate() == true) {
+                    pendingProxies.push_back(loop->second);
                 }
 
                 loop++;
@@ -86,9 +86,108 @@ namespace RPC {
             uint32_t _referenceCount;
         };
 
-        typedef std::list<ProxyStub::UnknownProxy*> ProxyList;
-        typedef std::map<const Core::IPCChannel*, ProxyList> ChannelMap;
-        typedef std::map<const Core::IPCChannel*, std::list< RecoverySet > > ReferenceMap;
+        // Proxies are found by the implementation they stand for and the interface they offer of it, references by
+        // the object handed out and the interface it was handed out as.
+        template <typename INSTANCE>
+        class KeyType {
+        public:
+            struct Hash {
+                size_t operator()(const KeyType<INSTANCE>& key) const
+                {
+                    return (std::hash<INSTANCE>()(key._instance) ^ (static_cast<size_t>(key._interfaceId) * 0x9E3779B1));
+                }
+            };
+
+        public:
+            KeyType() = delete;
+
+            KeyType(const INSTANCE instance, const uint32_t interfaceId)
+                : _instance(instance)
+                , _interfaceId(interfaceId)
+            {
+            }
+            ~KeyType() = default;
+
+        public:
+            inline bool operator==(const KeyType<INSTANCE>& rhs) const
+            {
+                return ((_instance == rhs._instance) && (_interfaceId == rhs._interfaceId));
+            }
+
+        private:
+            INSTANCE _instance;
+            uint32_t _interfaceId;
+        };
+
+        typedef KeyType<Core::instance_id> ProxyKey;
+        typedef KeyType<const Core::IUnknown*> ReferenceKey;
+
+        // Next to a proxy that is released (but not yet unregistered) a new one might be created for the same
+        // implementation and interface, so a key can hold more than one proxy.
+        typedef std::unordered_multimap<ProxyKey, ProxyStub::UnknownProxy*, ProxyKey::Hash> ProxyList;
+        typedef std::unordered_map<const Core::IPCChannel*, ProxyList> ChannelMap;
+
+        // The references handed out over a channel. If the channel dies, they are released in the order they
+        // were handed out.
+        class RecoveryList {
+        private:
+            typedef std::list<RecoverySet> Sets;
+            typedef std::unordered_map<ReferenceKey, Sets::iterator, ReferenceKey::Hash> Index;
+
+        public:
+            RecoveryList(const RecoveryList&) = delete;
+            RecoveryList& operator=(const RecoveryList&) = delete;
+
+            RecoveryList()
+                : _sets()
+                , _index()
+            {
+            }
+            ~RecoveryList() = default;
+
+        public:
+            inline bool IsEmpty() const
+            {
+                return (_sets.empty());
+            }
+            inline Sets::iterator begin()
+            {
+                return (_sets.begin());
+            }
+            inline Sets::iterator end()
+            {
+                return (_sets.end());
+            }
+            RecoverySet* Find(const Core::IUnknown* object, const uint32_t id)
+            {
+                Index::iterator index(_index.find(ReferenceKey(object, id)));
+                return (index != _index.end() ? &(*(index->second)) : nullptr);
+            }
+            void Add(Core::IUnknown* object, const uint32_t id)
+            {
+                ASSERT(Find(object, id) == nullptr);
+
+                _sets.emplace_back(id, object);
+                _index.emplace(ReferenceKey(object, id), std::prev(_sets.end()));
+            }
+            void Remove(const Core::IUnknown* object, const uint32_t id)
+            {
+                Index::iterator index(_index.find(ReferenceKey(object, id)));
+
+                ASSERT(index != _index.end());
+
+                if (index != _index.end()) {
+                    _sets.erase(index->second);
+                    _index.erase(index);
+                }
+            }
+
+        private:
+            Sets _sets;
+            Index _index;
+        };
+
+        typedef std::unordered_map<const Core::IPCChannel*, RecoveryList> ReferenceMap;
 
         struct EXTERNAL IMetadata {
             virtual ~IMetadata() = default;
@@ -174,9 +273,9 @@ namespace RPC {
         template <typename ACTUALINTERFACE>
         ACTUALINTERFACE* ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, const Core::instance_id& impl)
         {
-            ACTUALINTERFACE* result = nullptr;
-            ProxyFind(channel, impl, ACTUALINTERFACE::ID, result);
-            return (result);
+            void* proxyInterface = nullptr;
+            ProxyFind(channel, impl, ACTUALINTERFACE::ID, proxyInterface);
+            return (reinterpret_cast<ACTUALINTERFACE*>(proxyInterface));
         }
         ProxyStub::UnknownProxy* ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, const Core::instance_id& impl, const uint32_t id, void*& interface);
 
@@ -217,23 +316,19 @@ namespace RPC {
 
         void UnregisterInterface(Core::ProxyType<Core::IPCChannel>& channel, const Core::IUnknown* source, const uint32_t interfaceId, const uint32_t dropCount)
         {
-            _adminLock.Lock();
+            _referenceLock.Lock();
 
             ReferenceMap::iterator index(_channelReferenceMap.find(channel.operator->()));
 
             if (index != _channelReferenceMap.end()) {
-                std::list< RecoverySet >::iterator element(index->second.begin());
-
-                while ( (element != index->second.end()) && ((element->Id() != interfaceId) || (element->Unknown() != source)) ) {
-                    element++;
-                }
+                RecoverySet* element(index->second.Find(source, interfaceId));
 
-                ASSERT(element != index->second.end());
+                ASSERT(element != nullptr);
 
-                if (element != index->second.end()) {
+                if (element != nullptr) {
                     if (element->Decrement(dropCount) == false) {
-                        index->second.erase(element);
-                        if (index->second.size() == 0) {
+                        index->second.Remove(source, interfaceId);
+                        if (index->second.IsEmpty() == true) {
                             _channelReferenceMap.erase(index);
                         }
                     }
@@ -244,7 +339,7 @@ namespace RPC {
                 printf("====> Unregistering an interface [0x%x, %d] from a non-existing channel!!!\n", interfaceId, Core::ProcessInfo().Id());
             }
 
-            _adminLock.Unlock();
+            _referenceLock.Unlock();
         }
         void UnregisterProxy(const ProxyStub::UnknownProxy& proxy);
         
@@ -258,6 +353,8 @@ namespace RPC {
     private:
         // Seems like we have enough information, open up the Process communcication Channel.
         Core::CriticalSection _adminLock;
+        // The references are handed out and returned by the stubs, independent of the proxies, so they have a lock of their own.
+        Core::CriticalSection _referenceLock;
         std::map<uint32_t, ProxyStub::UnknownStub*> _stubs;
         std::map<uint32_t, IMetadata*> _proxy;
         Core::ProxyPoolType<InvokeMessage> _factory;
@@ -394,7 +491,9 @@ namespace RPC {
             Core::ProxyType<Job> job(Job::Instance());
 
             job->Set(source, message, _handler);
-            _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(job));
+
+            // Announcements gate the (de)activation of out-of-process plugins, do not let them wait for invokes.
+            _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(job), (message->Label() == AnnounceMessage::Id() ? Core::ThreadPool::CRITICAL : Core::ThreadPool::NORMAL));
         }
 
     private:
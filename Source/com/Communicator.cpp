@@ -613,6 +613,12 @@ POP_WARNING()
                 // Also load the ProxyStubs before we do anything else
                 RPC::LoadProxyStubs(proxyStubPath);
             }
+
+            string lane(announceMessage->Response().Lane());
+            if (lane.empty() == false) {
+                // The server is on this host, frames that fit can skip the socket from now on.
+                BaseClass::OpenLane(lane, false);
+            }
         }
 
         // Set event so WaitForCompletion() can continue.
@@ -1176,7 +1176,24 @@ namespace RPC {
 
                     void* result = _parent.Announce(proxyChannel, message->Parameters());
 
-                    message->Response().Set(instance_cast<void*>(result), proxyChannel->Extension().Id(), _parent.ProxyStubPath(), jsonDefaultMessagingSettings, jsonDefaultWarningReportingSettings);
+                    // Processes on this host get a lane next to the channel. It is created here, the first
+                    // time the process announces itself, and the process attaches to it with the response.
+                    string lane;
+                    const Core::NodeId& node(proxyChannel->Source().LocalNode());
+
+                    if ((node.Type() == Core::NodeId::TYPE_DOMAIN) && (proxyChannel->Lane().IsOpen() == false)) {
+                        const string path(node.HostName());
+
+                        if ((path.empty() == false) && (path[0] != '@')) {
+                            lane = path + _T(".lane.") + Core::NumberType<uint32_t>(proxyChannel->Extension().Id()).Text();
+
+                            if (proxyChannel->OpenLane(lane, true) != Core::ERROR_NONE) {
+                                lane.clear();
+                            }
+                        }
+                    }
+
+                    message->Response().Set(instance_cast<void*>(result), proxyChannel->Extension().Id(), _parent.ProxyStubPath(), jsonDefaultMessagingSettings, jsonDefaultWarningReportingSettings, lane);
 
                     // We are done, report completion
                     channel.ReportResponse(data);
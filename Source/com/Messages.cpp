@@ -0,0 +1,105 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Messages.h"
+
+namespace WPEFramework {
+namespace RPC {
+namespace Data {
+
+    namespace {
+
+        // Both processes on this host can reach it, and the name is unique, for every process and every segment.
+        string SegmentName()
+        {
+            static const string prefix(_T("/tmp/comrpc.") + Core::NumberType<uint32_t>(static_cast<uint32_t>(Core::ProcessInfo().Id())).Text() + '.');
+            static std::atomic<uint32_t> sequence(0);
+
+            return (prefix + Core::NumberType<uint32_t>(sequence++).Text());
+        }
+    }
+
+    Frame::Segment::Segment(const uint32_t size)
+        : Core::DataElementFile(SegmentName(),
+              Core::File::USER_READ | Core::File::USER_WRITE | Core::File::GROUP_READ | Core::File::GROUP_WRITE | Core::File::SHAREABLE | Core::File::CREATE,
+              size)
+        , _owner(true)
+    {
+    }
+
+    Frame::Segment::Segment(const string& name)
+        : Core::DataElementFile(name, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE, 0)
+        , _owner(false)
+    {
+        // Writable, as stubs may hand an input buffer to the implementation to fill. Once mapped, the segment
+        // no longer needs a name, it is released with the last mapping.
+        Core::File(name).Destroy();
+    }
+
+    void Frame::Reclaim()
+    {
+        for (const Segment& segment : _segments) {
+            if (segment.IsOwner() == true) {
+                Core::File(segment.Name()).Destroy();
+            }
+        }
+    }
+
+    const Frame::Segment* Frame::HandOver(const uint32_t length, const uint8_t buffer[])
+    {
+        const Segment* result = nullptr;
+
+        _segments.emplace_back(length);
+
+        Segment& segment(_segments.back());
+
+        if ((segment.IsValid() == true) && (segment.Size() >= length)) {
+            ::memcpy(segment.Buffer(), buffer, length);
+            result = &segment;
+        } else {
+            TRACE_L1("Could not create a bulk buffer of %d bytes, sending it inline", length);
+
+            Core::File(segment.Name()).Destroy();
+            _segments.pop_back();
+        }
+
+        return (result);
+    }
+
+    const Frame::Segment* Frame::TakeOver(const string& name, const uint32_t length) const
+    {
+        const Segment* result = nullptr;
+
+        _segments.emplace_back(name);
+
+        const Segment& segment(_segments.back());
+
+        if ((segment.IsValid() == true) && (segment.Size() >= length)) {
+            result = &segment;
+        } else {
+            TRACE_L1("Could not take over the bulk buffer at %s", name.c_str());
+
+            _segments.pop_back();
+        }
+
+        return (result);
+    }
+}
+}
+}
@@ -33,15 +33,180 @@ namespace RPC {
     namespace Data {
         static const uint16_t IPC_BLOCK_SIZE = 512;
 
-        class Frame : public Core::FrameType<IPC_BLOCK_SIZE, true, uint16_t> {
+        // Buffers larger than this are not copied into the frame. They are handed over in a shared memory
+        // segment, of which the frame only carries the name.
+        static const uint32_t IPC_BULK_SIZE = 16 * 1024;
+
+        class EXTERNAL Frame : public Core::FrameType<IPC_BLOCK_SIZE, true, uint32_t> {
         private:
-            using BaseClass = Core::FrameType < IPC_BLOCK_SIZE, true, uint16_t>;
+            using BaseClass = Core::FrameType < IPC_BLOCK_SIZE, true, uint32_t>;
+
+            enum buffer : uint8_t {
+                INLINE = 0,
+                BULK = 1
+            };
+
+            class EXTERNAL Segment : public Core::DataElementFile {
+            public:
+                Segment() = delete;
+                Segment(const Segment&) = delete;
+                Segment& operator=(const Segment&) = delete;
+
+                // Creates a new segment, to hand over to the other side.
+                Segment(const uint32_t size);
+                // Takes over the segment the other side handed over.
+                Segment(const string& name);
+                ~Segment() override = default;
+
+            public:
+                inline bool IsOwner() const
+                {
+                    return (_owner);
+                }
+
+            private:
+                bool _owner;
+            };
+
+        public:
+            class Reader : public BaseClass::Reader {
+            public:
+                Reader& operator=(const Reader&) = delete;
+
+                Reader()
+                    : BaseClass::Reader()
+                    , _frame(nullptr)
+                    , _bulk(false)
+                {
+                }
+                Reader(const Frame& data, const uint32_t offset)
+                    : BaseClass::Reader(data, offset)
+                    , _frame(&data)
+                    , _bulk(false)
+                {
+                }
+                Reader(const Reader& copy)
+                    : BaseClass::Reader(copy)
+                    , _frame(copy._frame)
+                    , _bulk(false)
+                {
+                }
+                ~Reader() = default;
+
+            public:
+                // The buffer stays available as long as the frame is not cleared.
+                template <typename TYPENAME>
+                TYPENAME LockBuffer(const uint8_t*& buffer) const
+                {
+                    TYPENAME result;
+
+                    ASSERT(_frame != nullptr);
+
+                    _bulk = (Number<uint8_t>() == BULK);
+
+                    if (_bulk == false) {
+                        result = BaseClass::Reader::LockBuffer<TYPENAME>(buffer);
+                    } else {
+                        result = Number<TYPENAME>();
+
+                        const Segment* segment = _frame->TakeOver(Text(), result);
+
+                        if (segment != nullptr) {
+                            buffer = segment->Buffer();
+                        } else {
+                            buffer = nullptr;
+                            result = 0;
+                        }
+                    }
+
+                    return (result);
+                }
+                template <typename TYPENAME>
+                void UnlockBuffer(TYPENAME length) const
+                {
+                    if (_bulk == false) {
+                        BaseClass::Reader::UnlockBuffer<TYPENAME>(length);
+                    }
+
+                    _bulk = false;
+                }
+                template <typename TYPENAME>
+                TYPENAME Buffer(const TYPENAME maxLength, uint8_t buffer[]) const
+                {
+                    TYPENAME result;
+
+                    ASSERT(_frame != nullptr);
+
+                    if (Number<uint8_t>() == INLINE) {
+                        result = BaseClass::Reader::Buffer<TYPENAME>(maxLength, buffer);
+                    } else {
+                        result = Number<TYPENAME>();
+
+                        Segment segment(Text());
+
+                        if ((segment.IsValid() == true) && (segment.Size() >= result)) {
+                            ::memcpy(buffer, segment.Buffer(), (result > maxLength ? maxLength : result));
+                        } else {
+                            TRACE_L1("Could not take over the bulk buffer at %s", segment.Name().c_str());
+                            result = 0;
+                        }
+                    }
+
+                    return (result);
+                }
+
+            private:
+                const Frame* _frame;
+                mutable bool _bulk;
+            };
+            class Writer : public BaseClass::Writer {
+            public:
+                Writer& operator=(const Writer&) = delete;
+
+                Writer()
+                    : BaseClass::Writer()
+                    , _frame(nullptr)
+                {
+                }
+                Writer(Frame& data, const uint32_t offset)
+                    : BaseClass::Writer(data, offset)
+                    , _frame(&data)
+                {
+                }
+                Writer(const Writer& copy)
+                    : BaseClass::Writer(copy)
+                    , _frame(copy._frame)
+                {
+                }
+                ~Writer() = default;
+
+            public:
+                template <typename TYPENAME>
+                void Buffer(const TYPENAME length, const uint8_t buffer[])
+                {
+                    const Segment* segment = nullptr;
+
+                    ASSERT(_frame != nullptr);
+
+                    if ((static_cast<uint32_t>(length) > IPC_BULK_SIZE) && ((segment = _frame->HandOver(length, buffer)) != nullptr)) {
+                        Number<uint8_t>(BULK);
+                        Number<TYPENAME>(length);
+                        Text(segment->Name());
+                    } else {
+                        Number<uint8_t>(INLINE);
+                        BaseClass::Writer::Buffer<TYPENAME>(length, buffer);
+                    }
+                }
+
+            private:
+                Frame* _frame;
+            };
 
         public:
             Frame(Frame&) = delete;
             Frame& operator=(const Frame&) = delete;
 
-            Frame() : BaseClass() {
+            Frame() : BaseClass(), _segments() {
             }
             ~Frame() = default;
 
@@ -50,15 +215,34 @@ namespace RPC {
             friend class Output;
             friend class ObjectInterface;
 
-            uint16_t Serialize(const uint16_t offset, uint8_t stream[], const uint16_t maxLength) const
+            inline void Clear()
+            {
+                BaseClass::Clear();
+                _segments.clear();
+            }
+            // Removes the segments this frame handed over, that the other side did not take over (yet).
+            void Reclaim();
+
+            // What the Writer will need for a value, to size the frame up front.
+            template <typename TYPENAME>
+            static constexpr uint32_t BufferSize(const TYPENAME length)
             {
-                uint16_t copiedBytes((Size() - offset) > maxLength ? maxLength : (Size() - offset));
+                return (sizeof(uint8_t) + sizeof(TYPENAME) + (static_cast<uint32_t>(length) > IPC_BULK_SIZE ? 0 : static_cast<uint32_t>(length)));
+            }
+            static uint32_t TextSize(const string& text)
+            {
+                return (sizeof(uint16_t) + static_cast<uint32_t>(text.length() * sizeof(TCHAR)));
+            }
+
+            uint16_t Serialize(const uint32_t offset, uint8_t stream[], const uint16_t maxLength) const
+            {
+                uint16_t copiedBytes((Size() - offset) > maxLength ? maxLength : static_cast<uint16_t>(Size() - offset));
 
                 ::memcpy(stream, &(operator[](offset)), copiedBytes);
 
                 return (copiedBytes);
             }
-            uint16_t Deserialize(const uint16_t offset, const uint8_t stream[], const uint16_t maxLength)
+            uint16_t Deserialize(const uint32_t offset, const uint8_t stream[], const uint16_t maxLength)
             {
                 Size(offset + maxLength);
 
@@ -66,6 +250,13 @@ namespace RPC {
 
                 return (maxLength);
             }
+
+        private:
+            const Segment* HandOver(const uint32_t length, const uint8_t buffer[]);
+            const Segment* TakeOver(const string& name, const uint32_t length) const;
+
+        private:
+            mutable std::list<Segment> _segments;
         };
 
         class Input {
@@ -80,6 +271,8 @@ namespace RPC {
         public:
             inline void Clear()
             {
+                // The call is over, whatever the other side did not pick up by now, it never will.
+                _data.Reclaim();
                 _data.Clear();
             }
             void Set(Core::instance_id implementation, const uint32_t interfaceId, const uint8_t methodId)
@@ -116,6 +309,11 @@ namespace RPC {
             {
                 return (_data.Size());
             }
+            // A hint, of the size of the parameters that will be written.
+            inline void Reserve(const uint32_t parameters)
+            {
+                _data.Reserve(sizeof(Core::instance_id) + sizeof(uint32_t) + sizeof(uint8_t) + parameters);
+            }
             inline Frame::Writer Writer()
             {
                 return (Frame::Writer(_data, (sizeof(Core::instance_id) + sizeof(uint32_t) + sizeof(uint8_t))));
@@ -126,11 +324,11 @@ namespace RPC {
             }
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Serialize(offset, stream, maxLength));
             }
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Deserialize(offset, stream, maxLength));
             }
 
         private:
@@ -170,11 +368,11 @@ namespace RPC {
             }
             inline uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Serialize(offset, stream, maxLength));
             }
             inline uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Deserialize(offset, stream, maxLength));
             }
 
         private:
@@ -324,7 +522,7 @@ namespace RPC {
             {
                 _data.Clear();
             }
-            void Set(Core::instance_id implementation, const uint32_t sequenceNumber, const string& proxyStubPath, const string& messagingSettings, const string& warningReportingSettings)
+            void Set(Core::instance_id implementation, const uint32_t sequenceNumber, const string& proxyStubPath, const string& messagingSettings, const string& warningReportingSettings, const string& lane = EMPTY_STRING)
             {
                 uint16_t length = 0;
                 _data.SetNumber<Core::instance_id>(0, implementation);
@@ -332,7 +530,8 @@ namespace RPC {
                 
                 length = _data.SetText(sizeof(Core::instance_id) + sizeof(uint32_t), proxyStubPath);
                 length += _data.SetText(sizeof(Core::instance_id)+ sizeof(uint32_t) + length, messagingSettings);
-                _data.SetText(sizeof(Core::instance_id)+ sizeof(uint32_t) + length, warningReportingSettings);
+                length += _data.SetText(sizeof(Core::instance_id)+ sizeof(uint32_t) + length, warningReportingSettings);
+                _data.SetText(sizeof(Core::instance_id)+ sizeof(uint32_t) + length, lane);
             }
             inline bool IsSet() const {
                 return (_data.Size() > 0);
@@ -378,6 +577,25 @@ namespace RPC {
                 return (value);
             }
 
+            // Name of the lane the server created for this channel, empty if there is none.
+            string Lane() const
+            {
+                string value;
+
+                uint16_t length = sizeof(Core::instance_id) + sizeof(uint32_t) ;   // skip implentation and sequencenumber 
+                length += _data.GetText(length, value);  // skip proxyStub path
+                length += _data.GetText(length, value);  // skip messagingcategories 
+                length += _data.GetText(length, value);  // skip warningreportingcategories 
+
+                if (length < _data.Size()) {
+                    _data.GetText(length, value); 
+                } else {
+                    value.clear();
+                }
+
+                return (value);
+            }
+
             Core::instance_id Implementation() const
             {
                 Core::instance_id result = 0;
@@ -394,11 +612,11 @@ namespace RPC {
             }
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
             {
-                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Serialize(offset, stream, maxLength));
             }
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
-                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+                return (_data.Deserialize(offset, stream, maxLength));
             }
 
         private:
@@ -90,7 +90,7 @@ namespace Core {
         DoorBell& operator=(const DoorBell&) = delete;
 
         DoorBell(const TCHAR sourceName[]);
-        ~DoorBell();
+        virtual ~DoorBell();
 
     public:
         void Ring()
@@ -112,12 +112,18 @@ namespace Core {
 
             return (result);
         }
+        // Listen for the bell, without waiting for it to be rang.
+        bool Bind() const
+        {
+            return (_connectPoint.Bind());
+        }
         void Relinquish() {
             _connectPoint.Unbind();
         }
 
-    private:
-        void Ringing()
+    protected:
+        // Called on the ResourceMonitor thread, as soon as the bell is rang.
+        virtual void Ringing()
         {
             _signal.SetEvent();
         }
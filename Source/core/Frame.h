@@ -24,6 +24,38 @@
 namespace WPEFramework {
 namespace Core {
 
+    // All frames that own their buffer count their (re)allocations here, so it can be confirmed that a hot
+    // path, like the COM-RPC invokes, runs without them.
+    class EXTERNAL FrameStatistics {
+    private:
+        template <const uint32_t BLOCKSIZE, const bool BIG_ENDIAN_ORDERING, typename SIZE_CONTEXT>
+        friend class FrameType;
+
+    public:
+        FrameStatistics() = delete;
+        FrameStatistics(const FrameStatistics&) = delete;
+        FrameStatistics& operator=(const FrameStatistics&) = delete;
+
+    public:
+        static uint32_t Allocations()
+        {
+            return (_allocations.load(std::memory_order_relaxed));
+        }
+        static uint32_t Reallocations()
+        {
+            return (_reallocations.load(std::memory_order_relaxed));
+        }
+        static void Reset()
+        {
+            _allocations.store(0, std::memory_order_relaxed);
+            _reallocations.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        static std::atomic<uint32_t> _allocations;
+        static std::atomic<uint32_t> _reallocations;
+    };
+
     template <const uint32_t BLOCKSIZE, const bool BIG_ENDIAN_ORDERING = true, typename SIZE_CONTEXT = uint16_t>
     class FrameType {
     private:
@@ -41,6 +73,8 @@ namespace Core {
                 #ifndef __WINDOWS__
                 static_assert(STARTSIZE != 0, "This method can only be called if you specify an initial blocksize");
                 #endif  
+
+                FrameStatistics::_allocations.fetch_add(1, std::memory_order_relaxed);
             }
             AllocatorType(const AllocatorType<STARTSIZE, SIZETYPE>& copy)
                 : _bufferSize(copy._bufferSize)
@@ -52,6 +86,8 @@ namespace Core {
                 static_assert(STARTSIZE != 0, "This method can only be called if you specify an initial blocksize");
                 #endif
 
+                FrameStatistics::_allocations.fetch_add(1, std::memory_order_relaxed);
+
                 ::memcpy(_data, copy._data, _bufferSize);
             }
             AllocatorType(uint8_t buffer[], const SIZETYPE length)
@@ -91,14 +127,25 @@ namespace Core {
             {
                 if (requiredSize > _bufferSize) {
 
-                    SIZETYPE bufferSize = static_cast<uint32_t>(((requiredSize / (STARTSIZE ? STARTSIZE : 1)) + 1) * STARTSIZE);
+                    // Grow in size classes, the blocksize doubled until it fits. A growing frame reallocates only a
+                    // few times, and frames that are reused settle on a size that fits all they carry.
+                    uint64_t bufferSize = (_bufferSize > STARTSIZE ? _bufferSize : STARTSIZE);
+
+                    while (bufferSize < requiredSize) {
+                        bufferSize <<= 1;
+                    }
+                    if (bufferSize > std::numeric_limits<SIZETYPE>::max()) {
+                        bufferSize = std::numeric_limits<SIZETYPE>::max();
+                    }
 
                     // oops we need to "reallocate".
-                    uint8_t* data = reinterpret_cast<uint8_t*>(::realloc(_data, bufferSize));
+                    uint8_t* data = reinterpret_cast<uint8_t*>(::realloc(_data, static_cast<size_t>(bufferSize)));
 
                     if (data != nullptr) {
+                        FrameStatistics::_reallocations.fetch_add(1, std::memory_order_relaxed);
+
                         _data = data;
-                        _bufferSize = bufferSize;
+                        _bufferSize = static_cast<SIZETYPE>(bufferSize);
                     }
                 }
             }
@@ -378,6 +425,11 @@ namespace Core {
 
             _size = size;
         }
+        // Makes room for what will be written, so the frame does not have to grow while it is written.
+        inline void Reserve(const SIZE_CONTEXT size)
+        {
+            _data.Allocate(size);
+        }
         template <typename TYPENAME>
         uint32_t SetBuffer(const SIZE_CONTEXT offset, const TYPENAME& length, const uint8_t buffer[])
         {
@@ -22,6 +22,7 @@
 
 #include "Factory.h"
 #include "IAction.h"
+#include "IPCLane.h"
 #include "Link.h"
 #include "Module.h"
 #include "Portability.h"
@@ -37,7 +38,13 @@ namespace Core {
     struct IMessage {
     public:
         typedef IMessage BaseElement;
-        typedef uint32_t Identifier;
+
+        // A frame carries its label and a sequence, the sequence of a response is that of the request it answers,
+        // so more requests can be outstanding on a channel and they can be answered in any order.
+        struct Identifier {
+            uint32_t Label;
+            uint32_t Sequence;
+        };
 
         class Serializer {
         public:
@@ -82,7 +89,7 @@ namespace Core {
 
                 while ((_current != nullptr) && (result < maxLength)) {
                     if (_offset < 4) {
-                        uint32_t length = _length + CommandSize();
+                        uint32_t length = _length + HeaderSize();
 
                         // Write the length. Continue as long as the top bt is active..
                         while ((_offset < 4) && (result < maxLength)) {
@@ -111,16 +118,29 @@ namespace Core {
                         }
                     }
 
+                    // Write the sequence, Same structure as length..
+                    while ((_offset < 12) && (result < maxLength)) {
+                        uint32_t value = _current->Sequence() >> (7 * (_offset - 8));
+                        stream[result] = ((value & 0x7F) | (value >= 0x80 ? 0x80 : 0x00));
+                        result++;
+
+                        if (value >= 0x80) {
+                            _offset++;
+                        } else {
+                            _offset = 12;
+                        }
+                    }
+
                     if (result < maxLength) {
                         // Write the command, Same structure as length..
-                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 8);
+                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 12);
 
                         result += handled;
                         _offset += handled;
 
-                        ASSERT_VERBOSE((_offset - 8) <= _length, "%d <= %d", (_offset - 8), _length);
+                        ASSERT_VERBOSE((_offset - 12) <= _length, "%d <= %d", (_offset - 12), _length);
 
-                        if ((_offset - 8) == _length) {
+                        if ((_offset - 12) == _length) {
                             const IMessage* ready = _current;
                             _current = nullptr;
 
@@ -135,9 +155,13 @@ namespace Core {
             virtual void Serialized(const IMessage& element) = 0;
 
         private:
-            inline uint32_t CommandSize() const
+            inline uint32_t HeaderSize() const
+            {
+                return (Size(_current->Label()) + Size(_current->Sequence()));
+            }
+            static inline uint32_t Size(const uint32_t value)
             {
-                return (_current->Label() > 0x1FFFFF ? 4 : (_current->Label() > 0xCFFF ? 3 : (_current->Label() > 0x7F ? 2 : 1)));
+                return (value > 0x1FFFFF ? 4 : (value > 0x3FFF ? 3 : (value > 0x7F ? 2 : 1)));
             }
 
         private:
@@ -154,7 +178,7 @@ namespace Core {
             Deserializer()
                 : _length(0)
                 , _offset(0)
-                , _label(0)
+                , _identifier()
                 , _current(nullptr)
             {
             }
@@ -162,14 +186,14 @@ namespace Core {
 
         public:
             virtual void Deserialized(IMessage& element) = 0;
-            virtual IMessage* Element(const uint32_t& label) = 0;
+            virtual IMessage* Element(const Identifier& identifier) = 0;
 
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength)
             {
                 uint16_t result = 0;
 
                 while (result < maxLength) {
-					if ((_current == nullptr) && (_offset < 8)) {
+					if ((_current == nullptr) && (_offset < 12)) {
                         // We have nothing, start by getting the length/command
                         while ((_offset < 4) && (result < maxLength)) {
                             _length |= ((stream[result] & (_offset == 3 ? 0xFF : 0x7F)) << (7 * _offset));
@@ -182,7 +206,7 @@ namespace Core {
                         }
 
                         while ((_offset < 8) && (result < maxLength)) {
-                            _label |= ((stream[result] & (_offset == 7 ? 0xFF : 0x7F)) << (7 * (_offset - 4)));
+                            _identifier.Label |= ((stream[result] & (_offset == 7 ? 0xFF : 0x7F)) << (7 * (_offset - 4)));
                             _length--;
 
                             if ((stream[result++] & 0x80) != 0) {
@@ -192,30 +216,42 @@ namespace Core {
                             }
                         }
 
-                        if (_offset == 8) {
-                            _current = Element(_label);
-                            _label = 0;
+                        while ((_offset < 12) && (result < maxLength)) {
+                            _identifier.Sequence |= ((stream[result] & (_offset == 11 ? 0xFF : 0x7F)) << (7 * (_offset - 8)));
+                            _length--;
+
+                            if ((stream[result++] & 0x80) != 0) {
+                                _offset++;
+                            } else {
+                                _offset = 12;
+                            }
+                        }
+
+                        if (_offset == 12) {
+                            _current = Element(_identifier);
+                            _identifier.Label = 0;
+                            _identifier.Sequence = 0;
                         }
                     }
 
-                    ASSERT((_offset - 8) <= _length);
+                    ASSERT((_offset - 12) <= _length);
 
-                    if ((_offset - 8) < _length) {
+                    if ((_offset - 12) < _length) {
 
                         // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
-                        uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 8)) ? static_cast<uint16_t>(_length - (_offset - 8)) : (maxLength - result));
+                        uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 12)) ? static_cast<uint16_t>(_length - (_offset - 12)) : (maxLength - result));
 
                         if (_current != nullptr) {
-                            handled = _current->Deserialize(&stream[result], handled, _offset - 8);
+                            handled = _current->Deserialize(&stream[result], handled, _offset - 12);
                         }
 
                         _offset += handled;
                         result += handled;
                     }
 
-                    ASSERT((_offset - 8) <= _length);
+                    ASSERT((_offset - 12) <= _length);
 
-                    if ((_offset - 8) == _length) {
+                    if ((_offset - 12) == _length) {
                         if (_current != nullptr) {
                             IMessage* ready = _current;
                             _current = nullptr;
@@ -231,7 +267,7 @@ namespace Core {
         private:
             uint32_t _length;
             uint32_t _offset;
-            uint32_t _label;
+            Identifier _identifier;
             IMessage* _current;
         };
 
@@ -239,6 +275,7 @@ namespace Core {
         virtual ~IMessage() = default;
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
         virtual uint32_t Length() const = 0;
         virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) const = 0;
         virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) = 0;
@@ -248,6 +285,8 @@ namespace Core {
         virtual ~IIPC() = default;
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
+        virtual void Sequence(const uint32_t sequence) = 0;
         virtual ProxyType<IMessage> IParameters() = 0;
         virtual ProxyType<IMessage> IResponse() = 0;
     };
@@ -303,6 +342,10 @@ namespace Core {
             {
                 return (REALIDENTIFIER);
             }
+            uint32_t Sequence() const override
+            {
+                return (_parent.Sequence());
+            }
             uint32_t Length() const override
             {
                 return (_Length());
@@ -415,11 +458,13 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         IPCMessageType()
             : _parameters(*this)
             , _response(*this)
+            , _sequence(0)
         {
         }
         IPCMessageType(const PARAMETERS& info)
             : _parameters(*this, info)
             , _response(*this)
+            , _sequence(0)
         {
         }
 POP_WARNING()
@@ -449,6 +494,14 @@ POP_WARNING()
         {
             return (IDENTIFIER);
         }
+        uint32_t Sequence() const override
+        {
+            return (_sequence);
+        }
+        void Sequence(const uint32_t sequence) override
+        {
+            _sequence = sequence;
+        }
         virtual ProxyType<IMessage> IParameters()
         {
             return (ProxyType<IMessage>(_parameters, _parameters));
@@ -461,6 +514,7 @@ POP_WARNING()
     private:
         ParameterType _parameters;
         ResponseType _response;
+        uint32_t _sequence;
     };
 
     class EXTERNAL IPCChannel {
@@ -469,11 +523,16 @@ POP_WARNING()
         private:
             friend IPCChannel;
 
+            struct Outbound {
+                Core::ProxyType<IIPC> Message;
+                IDispatchType<IIPC>* Callback;
+            };
+
             IPCFactory()
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _sequence(0)
                 , _factory()
                 , _handlers()
             {
@@ -493,7 +552,7 @@ POP_WARNING()
                 : _lock()
                 , _inbound()
                 , _outbound()
-                , _callback(nullptr)
+                , _sequence(0)
                 , _factory(factory)
                 , _handlers()
             {
@@ -546,29 +605,44 @@ POP_WARNING()
 
             inline bool InProgress() const
             {
-                return (_outbound.IsValid());
+                _lock.Lock();
+
+                bool result = (_outbound.empty() == false);
+
+                _lock.Unlock();
+
+                return (result);
             }
 
-            inline ProxyType<IMessage> Element(const uint32_t& identifier)
+            inline ProxyType<IMessage> Element(const IMessage::Identifier& identifier)
+            {
+                return (Element(identifier, _inbound));
+            }
+            // Each source of frames (the link, a lane) needs its own slot for the inbound call it is receiving.
+            inline ProxyType<IMessage> Element(const IMessage::Identifier& identifier, ProxyType<IIPC>& slot)
             {
                 ProxyType<IMessage> result;
-                uint32_t searchIdentifier(identifier >> 1);
+                uint32_t searchIdentifier(identifier.Label >> 1);
 
                 _lock.Lock();
 
-                if (identifier & 0x01) {
-                    if ((_outbound.IsValid() == true) && (_outbound->Label() == searchIdentifier)) {
-                        result = _outbound->IResponse();
+                if (identifier.Label & 0x01) {
+                    std::map<uint32_t, Outbound>::iterator index(_outbound.find(identifier.Sequence));
+
+                    if ((index != _outbound.end()) && (index->second.Message->Label() == searchIdentifier)) {
+                        result = index->second.Message->IResponse();
                     } else {
-                        TRACE_L1("Unexpected response message for ID [%d].\n", searchIdentifier);
+                        TRACE_L1("Unexpected response message for ID [%d], sequence [%d].\n", searchIdentifier, identifier.Sequence);
                     }
                 } else {
-                    ASSERT(_inbound.IsValid() == false);
+                    ASSERT(slot.IsValid() == false);
 
                     ProxyType<IIPC> rpcCall(_factory->Element(searchIdentifier));
 
                     if (rpcCall.IsValid() == true) {
-                        _inbound = rpcCall;
+                        // Whatever we respond, it should go back with the sequence of this request.
+                        rpcCall->Sequence(identifier.Sequence);
+                        slot = rpcCall;
                         result = rpcCall->IParameters();
                     } else {
                         TRACE_L1("No RPC method definition for ID [%d].\n", searchIdentifier);
@@ -586,11 +660,8 @@ POP_WARNING()
 
                 TRACE_L1("Flushing the IPC mechanims. %d", __LINE__);
 
-                _callback = nullptr;
+                _outbound.clear();
 
-                if (_outbound.IsValid() == true) {
-                    _outbound.Release();
-                }
                 if (_inbound.IsValid() == true) {
                     _inbound.Release();
                 }
@@ -599,36 +670,47 @@ POP_WARNING()
             }
 
             inline ProxyType<IIPCServer> ReceivedMessage(const Core::ProxyType<IMessage>& rhs, Core::ProxyType<IIPC>& inbound)
+            {
+                return (ReceivedMessage(rhs, _inbound, inbound));
+            }
+            inline ProxyType<IIPCServer> ReceivedMessage(const Core::ProxyType<IMessage>& rhs, Core::ProxyType<IIPC>& slot, Core::ProxyType<IIPC>& inbound)
             {
                 ProxyType<IIPCServer> procedure;
 
                 _lock.Lock();
 
-                if ((_outbound.IsValid() == true) && (_outbound->IResponse() == rhs)) {
+                if ((rhs->Label() & 0x01) != 0) {
+                    std::map<uint32_t, Outbound>::iterator index(_outbound.find(rhs->Sequence()));
 
-                    ASSERT(_callback != nullptr);
+                    if ((index != _outbound.end()) && (index->second.Message->IResponse() == rhs)) {
 
-                    ProxyType<IIPC> handledObject(_outbound);
+                        ASSERT(index->second.Callback != nullptr);
 
-                    _outbound.Release();
-                    _callback->Dispatch(*handledObject);
-                    _callback = nullptr;
+                        ProxyType<IIPC> handledObject(index->second.Message);
+                        IDispatchType<IIPC>* callback(index->second.Callback);
+
+                        _outbound.erase(index);
+                        callback->Dispatch(*handledObject);
+                    } else {
+                        // The call was aborted (timed out) while its response was coming in.
+                        TRACE_L1("Response for sequence [%d] is no longer awaited.", rhs->Sequence());
+                    }
                 }
-                // If this is *NOT* the outbound call, it is inbound and thus it must have been registered
-                else if (_inbound.IsValid() == true) {
+                // If this is *NOT* an outbound call, it is inbound and thus it must have been registered
+                else if (slot.IsValid() == true) {
 
-                    std::map<uint32_t, ProxyType<IIPCServer>>::iterator index(_handlers.find(_inbound->Label()));
+                    std::map<uint32_t, ProxyType<IIPCServer>>::iterator index(_handlers.find(slot->Label()));
 
 					ASSERT(index != _handlers.end());
 
                     if (index != _handlers.end()) {
                         procedure = (*index).second;
-                        inbound = _inbound;
+                        inbound = slot;
                     } else {
-                        TRACE_L1("No handler defined to handle the incoming frames. [%d]", _inbound->Label());
+                        TRACE_L1("No handler defined to handle the incoming frames. [%d]", slot->Label());
                     }
 
-                    _inbound.Release();
+                    slot.Release();
                 } else {
                     ASSERT(false && "Received something that is neither an inbound nor on outbound!!!");
                 }
@@ -638,37 +720,42 @@ POP_WARNING()
                 return (procedure);
             }
 
-            inline void SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback)
+            inline uint32_t SetOutbound(const Core::ProxyType<IIPC>& outbound, IDispatchType<IIPC>* callback)
             {
                 _lock.Lock();
 
                 ASSERT((outbound.IsValid() == true) && (callback != nullptr));
-                ASSERT((_outbound.IsValid() == false) && (_callback == nullptr));
 
-                _outbound = outbound;
-                _callback = callback;
+                // Keep the sequence within the 4 bytes the frame header has for it.
+                _sequence = ((_sequence + 1) & 0x0FFFFFFF);
+
+                ASSERT(_outbound.find(_sequence) == _outbound.end());
+
+                outbound->Sequence(_sequence);
+                _outbound.insert(std::pair<uint32_t, Outbound>(_sequence, Outbound { outbound, callback }));
+
+                uint32_t sequence(_sequence);
 
                 _lock.Unlock();
+
+                return (sequence);
             }
 
-            inline bool AbortOutbound()
+            inline bool AbortOutbound(const uint32_t sequence)
             {
                 bool result = false;
 
                 _lock.Lock();
 
-                if (_outbound.IsValid() == true) {
+                std::map<uint32_t, Outbound>::iterator index(_outbound.find(sequence));
+
+                if (index != _outbound.end()) {
 
                     result = true;
 
-                    if (_callback != nullptr) {
-                        _callback->Dispatch(*_outbound);
-                        _callback = nullptr;
-                    }
+                    index->second.Callback->Dispatch(*(index->second.Message));
 
-                    _outbound.Release();
-                } else {
-                    ASSERT(_callback == nullptr);
+                    _outbound.erase(index);
                 }
 
                 _lock.Unlock();
@@ -676,11 +763,30 @@ POP_WARNING()
                 return (result);
             }
 
+            inline bool AbortOutbound()
+            {
+                bool result = false;
+
+                _lock.Lock();
+
+                result = (_outbound.empty() == false);
+
+                for (std::pair<const uint32_t, Outbound>& entry : _outbound) {
+                    entry.second.Callback->Dispatch(*(entry.second.Message));
+                }
+
+                _outbound.clear();
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
         private:
             mutable CriticalSection _lock;
             Core::ProxyType<IIPC> _inbound;
-            mutable Core::ProxyType<IIPC> _outbound;
-            IDispatchType<IIPC>* _callback;
+            std::map<uint32_t, Outbound> _outbound;
+            uint32_t _sequence;
             Core::ProxyType<FactoryType<IIPC, uint32_t>> _factory;
             std::map<uint32_t, ProxyType<IIPCServer>> _handlers;
         };
@@ -773,14 +879,6 @@ POP_WARNING()
             ~IPCLink() override = default;
 
         public:
-            inline bool SendResponse(Core::ProxyType<IIPC>& inbound)
-            {
-                ASSERT(inbound.IsValid() == true);
-
-                // This is an inbound call, Report what we have processed !!!
-                return (BaseClass::Submit(inbound->IResponse()));
-            }
-
             // Notification of a INBOUND element received.
             void Received(Core::ProxyType<IMessage>& message) override
             {
@@ -804,6 +902,7 @@ POP_WARNING()
             {
                 if (_parent.Source().IsOpen() == false) {
                     // Whatever s hapening, Flush what we were doing..
+                    _parent._lane.Close();
                     _parent.Abort();
                     _factory.Flush();
                 }
@@ -829,16 +928,16 @@ POP_WARNING()
             ~IPCTrigger() override = default;
 
         public:
-            uint32_t Wait(const uint32_t waitTime)
+            uint32_t Wait(const uint32_t sequence, const uint32_t waitTime)
             {
                 uint32_t result = Core::ERROR_NONE;
 
                 // Now we wait for ever, to get a signal that we are done :-)
                 if (_signal.Lock(waitTime) != Core::ERROR_NONE) {
-                    _administration.AbortOutbound();
+                    _administration.AbortOutbound(sequence);
 
                     result = Core::ERROR_TIMEDOUT;
-                } else if (_administration.AbortOutbound() == true) {
+                } else if (_administration.AbortOutbound(sequence) == true) {
                     result = Core::ERROR_ASYNC_FAILED;
                 }
 
@@ -853,6 +952,95 @@ POP_WARNING()
             IPCFactory& _administration;
             Event _signal;
         };
+        class IPCLaneLink : public IPCLane, public IMessage::Deserializer {
+        private:
+            class FrameSerializer : public IMessage::Serializer {
+            public:
+                FrameSerializer(const FrameSerializer&) = delete;
+                FrameSerializer& operator=(const FrameSerializer&) = delete;
+
+                FrameSerializer() = default;
+                ~FrameSerializer() override = default;
+
+            private:
+                void Serialized(const IMessage& /* element */) override
+                {
+                }
+            };
+
+        public:
+            IPCLaneLink() = delete;
+            IPCLaneLink(const IPCLaneLink&) = delete;
+            IPCLaneLink& operator=(const IPCLaneLink&) = delete;
+
+            IPCLaneLink(IPCChannelType<ACTUALSOURCE, EXTENSION>* parent, IPCFactory* factory)
+                : IPCLane()
+                , IMessage::Deserializer()
+                , _factory(*factory)
+                , _parent(*parent)
+                , _slot()
+                , _current()
+            {
+            }
+            ~IPCLaneLink() override
+            {
+                // Stop receiving before we are gone, the lane itself is closed too late for that.
+                IPCLane::Close();
+            }
+
+        public:
+            // Returns false if the frame should go over the link.
+            bool Submit(const Core::ProxyType<IMessage>& message)
+            {
+                bool result = false;
+
+                // Leave room for the largest header a frame can have: length, label and sequence.
+                if ((IsEstablished() == true) && (message->Length() <= static_cast<uint32_t>(MaxFrameSize - 12))) {
+                    uint8_t frame[MaxFrameSize];
+                    FrameSerializer serializer;
+
+                    serializer.Submit(*message);
+
+                    const uint16_t length = serializer.Serialize(frame, sizeof(frame));
+
+                    result = Write(frame, length);
+                }
+
+                return (result);
+            }
+
+        private:
+            void Received(const uint8_t frame[], const uint16_t length) override
+            {
+                // Frames are written to the lane as a whole, so each one is handled completely.
+                IMessage::Deserializer::Deserialize(frame, length);
+            }
+            IMessage* Element(const IMessage::Identifier& identifier) override
+            {
+                _current = _factory.Element(identifier, _slot);
+
+                return (_current.IsValid() == true ? &(*_current) : nullptr);
+            }
+            void Deserialized(IMessage& element VARIABLE_IS_NOT_USED) override
+            {
+                ASSERT(&element == &(*_current));
+
+                Core::ProxyType<IIPC> inbound;
+                ProxyType<IIPCServer> handler(_factory.ReceivedMessage(_current, _slot, inbound));
+
+                _current.Release();
+
+                if (handler.IsValid() == true) {
+                    _parent.CallProcedure(handler, inbound);
+                }
+            }
+
+        private:
+            IPCFactory& _factory;
+            IPCChannelType<ACTUALSOURCE, EXTENSION>& _parent;
+            Core::ProxyType<IIPC> _slot;
+            Core::ProxyType<IMessage> _current;
+        };
 
     public:
         IPCChannelType(const IPCChannelType<ACTUALSOURCE, EXTENSION>&) = delete;
@@ -862,6 +1050,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         template <typename... Args>
         IPCChannelType(Args&&... args)
             : IPCChannel()
+            , _lane(this, &_administration)
             , _link(this, &_administration, std::forward<Args>(args)...)
             , _extension(this)
         {
@@ -869,6 +1058,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         template <typename... Args>
         IPCChannelType(Core::ProxyType<FactoryType<IIPC, uint32_t>>& factory, Args&&... args)
             : IPCChannel(factory)
+            , _lane(this, &_administration)
             , _link(this, &_administration, std::forward<Args>(args)...)
             , _extension(this)
         {
@@ -898,11 +1088,27 @@ POP_WARNING()
         {
             return (_administration.InProgress());
         }
+        // Both processes on this host can share a lane, to exchange the smaller frames through shared memory in
+        // stead of through the socket. One side creates it, and passes its name over the channel, the other side
+        // attaches to it. The lane is closed with the socket.
+        inline uint32_t OpenLane(const string& name, const bool create)
+        {
+            return (create == true ? _lane.Create(name) : _lane.Attach(name));
+        }
+        inline void CloseLane()
+        {
+            _lane.Close();
+        }
+        inline const IPCLane& Lane() const
+        {
+            return (_lane);
+        }
         uint32_t ReportResponse(Core::ProxyType<IIPC>& inbound) override
         {
+            ASSERT(inbound.IsValid() == true);
 
-            // We got the event, start the invoke, wait for the event to be set again..
-            _link.SendResponse(inbound);
+            // This is an inbound call, Report what we have processed !!!
+            Submit(inbound->IResponse());
 
             return (Core::ERROR_NONE);
         }
@@ -928,59 +1134,59 @@ POP_WARNING()
         {
         }
 
+        // Calls are not serialized, each gets its own sequence and waits for the response carrying it, so a slow
+        // call does not hold up the others on this channel.
         uint32_t Execute(ProxyType<IIPC>& command, IDispatchType<IIPC>* completed) override
         {
             uint32_t success = Core::ERROR_UNAVAILABLE;
 
-            _serialize.Lock();
-
-            if (_administration.InProgress() == true) {
-                success = Core::ERROR_INPROGRESS;
-            } else if (_link.IsOpen() == true) {
+            if (_link.IsOpen() == true) {
                 // We need to accept a CONST object to avoid an additional object creation
                 // proxy casted objects.
                 _administration.SetOutbound(command, completed);
 
                 // Send out the
-                _link.Submit(command->IParameters());
+                Submit(command->IParameters());
 
                 success = Core::ERROR_NONE;
             }
 
-            _serialize.Unlock();
-
             return (success);
         }
         uint32_t Execute(ProxyType<IIPC>& command, const uint32_t waitTime) override
         {
             uint32_t success = Core::ERROR_CONNECTION_CLOSED;
 
-            _serialize.Lock();
-
             if (_link.IsOpen() == true) {
                 IPCTrigger sink(_administration);
 
                 // We need to accept a CONST object to avoid an additional object creation
                 // proxy casted objects.
-                _administration.SetOutbound(command, &sink);
+                const uint32_t sequence = _administration.SetOutbound(command, &sink);
 
                 // Send out the
-                _link.Submit(command->IParameters());
+                Submit(command->IParameters());
 
-                success = sink.Wait(waitTime);
+                success = sink.Wait(sequence, waitTime);
             }
 
-            _serialize.Unlock();
-
             return (success);
         }
         inline void CallProcedure(ProxyType<IIPCServer>& procedure, ProxyType<IIPC>& message)
         {
             procedure->Procedure(*this, message);
         }
+        inline void Submit(const ProxyType<IMessage>& message)
+        {
+            // Frames on the lane and the link are not ordered, but every call waits for its own response anyway.
+            if (_lane.Submit(message) == false) {
+                _link.Submit(message);
+            }
+        }
 
     private:
-        CriticalSection _serialize;
+        // The lane goes after the link, the link reports the socket closing to it.
+        IPCLaneLink _lane;
         IPCLink _link;
         EXTENSION _extension;
     };
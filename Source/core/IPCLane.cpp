@@ -0,0 +1,201 @@
+ /*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IPCLane.h"
+
+namespace WPEFramework {
+
+namespace Core {
+
+    namespace {
+
+        // The rings are named after the side that writes them.
+        string RingName(const string& name, const bool creator)
+        {
+            return (name + (creator == true ? _T(".0") : _T(".1")));
+        }
+        string BellName(const string& name, const bool creator)
+        {
+            return (RingName(name, creator) + _T(".doorbell"));
+        }
+    }
+
+    IPCLane::Ring::Ring(IPCLane& parent, const string& name, const bool create)
+        : CyclicBuffer(name,
+              File::USER_READ | File::USER_WRITE | File::GROUP_READ | File::GROUP_WRITE | File::SHAREABLE,
+              (create == true ? RingSize : 0), false)
+        , _doorBell(parent, name + _T(".doorbell"))
+    {
+    }
+
+    /* virtual */ uint32_t IPCLane::Ring::GetReadSize(Cursor& cursor)
+    {
+        // Each entry is a frame, preceded by its size (including the size itself).
+        uint16_t entrySize = 0;
+        cursor.Peek(entrySize);
+        cursor.Forward(sizeof(entrySize));
+        return (entrySize > sizeof(entrySize) ? entrySize - sizeof(entrySize) : 0);
+    }
+
+    IPCLane::IPCLane()
+        : _lock()
+        , _name()
+        , _owner(false)
+        , _outbound(nullptr)
+        , _inbound(nullptr)
+        , _open(false)
+        , _established(false)
+    {
+    }
+
+    /* virtual */ IPCLane::~IPCLane()
+    {
+        Close();
+        Destroy();
+    }
+
+    uint32_t IPCLane::Create(const string& name)
+    {
+        return (Open(name, true));
+    }
+
+    uint32_t IPCLane::Attach(const string& name)
+    {
+        return (Open(name, false));
+    }
+
+    uint32_t IPCLane::Open(const string& name, const bool create)
+    {
+        uint32_t result = ERROR_ALREADY_CONNECTED;
+
+        _lock.Lock();
+
+        if (_open == false) {
+            // Whatever the previous lane left, it is no longer listened to, so it can go now.
+            Destroy();
+
+            _outbound = new Ring(*this, RingName(name, create), create);
+            _inbound = new Ring(*this, RingName(name, !create), create);
+
+            if ((_outbound->IsValid() == false) || (_inbound->IsValid() == false) || (_inbound->Bind() == false)) {
+                TRACE_L1("Could not open the IPC lane at %s", name.c_str());
+
+                Destroy();
+
+                if (create == true) {
+                    File(RingName(name, true)).Destroy();
+                    File(RingName(name, false)).Destroy();
+                }
+
+                result = ERROR_OPENING_FAILED;
+            } else {
+                _name = name;
+                _owner = create;
+                _open.store(true, std::memory_order_release);
+
+                // The creator waits for the first frame of the other side, the other side knows the creator is there.
+                _established.store(create == false, std::memory_order_release);
+
+                result = ERROR_NONE;
+            }
+        }
+
+        _lock.Unlock();
+
+        return (result);
+    }
+
+    void IPCLane::Close()
+    {
+        _lock.Lock();
+
+        if (_open == true) {
+            _open.store(false, std::memory_order_release);
+            _established.store(false, std::memory_order_release);
+
+            // Once unregistered, the doorbell is not handled anymore, but the rings are kept (and only
+            // destroyed on the next open) as this might be called while the lane is draining.
+            _inbound->Relinquish();
+
+            if (_owner == true) {
+                File(RingName(_name, true)).Destroy();
+                File(RingName(_name, false)).Destroy();
+                File(BellName(_name, true)).Destroy();
+                File(BellName(_name, false)).Destroy();
+            }
+        }
+
+        _lock.Unlock();
+    }
+
+    bool IPCLane::Write(const uint8_t frame[], const uint16_t length)
+    {
+        bool result = false;
+        const uint16_t entrySize = length + sizeof(uint16_t);
+
+        ASSERT(length <= MaxFrameSize);
+
+        _lock.Lock();
+
+        // Only the reader moves the tail, so the free space can only grow while we hold on to the lock.
+        if ((_established == true) && (length <= MaxFrameSize) && (_outbound->Free() > entrySize)) {
+
+            // Reserve the entry, the reader only sees it once all of it is written.
+            uint32_t reserved = _outbound->Reserve(entrySize);
+
+            DEBUG_VARIABLE(reserved);
+            ASSERT(reserved == entrySize);
+
+            _outbound->Write(reinterpret_cast<const uint8_t*>(&entrySize), sizeof(entrySize));
+            _outbound->Write(frame, length);
+
+            result = true;
+        }
+
+        _lock.Unlock();
+
+        return (result);
+    }
+
+    void IPCLane::Drain()
+    {
+        uint32_t length;
+
+        // Only called by the doorbell of the inbound ring, so this is the only reader.
+        while ((_open == true) && ((length = _inbound->Read(_frame, sizeof(_frame))) != 0)) {
+
+            _established.store(true, std::memory_order_release);
+
+            Received(_frame, static_cast<uint16_t>(length));
+        }
+    }
+
+    void IPCLane::Destroy()
+    {
+        if (_inbound != nullptr) {
+            delete _inbound;
+            _inbound = nullptr;
+        }
+        if (_outbound != nullptr) {
+            delete _outbound;
+            _outbound = nullptr;
+        }
+    }
+}
+}
@@ -0,0 +1,151 @@
+ /*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "CyclicBuffer.h"
+#include "DoorBell.h"
+#include "Sync.h"
+
+namespace WPEFramework {
+namespace Core {
+
+    // A lane runs next to an IPC channel between two processes on the same host: a shared memory ring
+    // for each direction. Frames that fit are copied into the ring of the sender and read from it by
+    // the receiver, without passing through the kernel. The receiver is only woken, through a doorbell,
+    // if the ring was empty, so under load most frames are exchanged without any system call.
+    //
+    // The creating side does not write to the lane before it has received something over it, so it
+    // never writes frames the other side will not read. Whatever does not fit in the ring (or did not
+    // find a lane) goes over the channel, so frames on the lane and the channel are not ordered.
+    class EXTERNAL IPCLane {
+    public:
+        // Frames up to this size go over the lane, larger ones are left to the channel.
+        static constexpr uint16_t MaxFrameSize = 4096;
+        static constexpr uint32_t RingSize = 64 * 1024;
+
+    private:
+        class EXTERNAL Ring : public CyclicBuffer {
+        private:
+            class Bell : public DoorBell {
+            public:
+                Bell() = delete;
+                Bell(const Bell&) = delete;
+                Bell& operator=(const Bell&) = delete;
+
+                Bell(IPCLane& parent, const string& name)
+                    : DoorBell(name.c_str())
+                    , _parent(parent)
+                {
+                }
+                ~Bell() override
+                {
+                    Relinquish();
+                }
+
+            private:
+                void Ringing() override
+                {
+                    _parent.Drain();
+                }
+
+            private:
+                IPCLane& _parent;
+            };
+
+        public:
+            Ring() = delete;
+            Ring(const Ring&) = delete;
+            Ring& operator=(const Ring&) = delete;
+
+            Ring(IPCLane& parent, const string& name, const bool create);
+            ~Ring() override = default;
+
+        public:
+            inline bool Bind() const
+            {
+                return (_doorBell.Bind());
+            }
+            inline void Relinquish()
+            {
+                _doorBell.Relinquish();
+            }
+            void DataAvailable() override
+            {
+                _doorBell.Ring();
+            }
+
+        private:
+            uint32_t GetReadSize(Cursor& cursor) override;
+
+        private:
+            Bell _doorBell;
+        };
+
+    public:
+        IPCLane(const IPCLane&) = delete;
+        IPCLane& operator=(const IPCLane&) = delete;
+
+        IPCLane();
+        virtual ~IPCLane();
+
+    public:
+        inline bool IsOpen() const
+        {
+            return (_open.load(std::memory_order_acquire));
+        }
+        // The other side is known to be there, so frames can be written to the lane.
+        inline bool IsEstablished() const
+        {
+            return (_established.load(std::memory_order_acquire));
+        }
+        inline const string& Name() const
+        {
+            return (_name);
+        }
+
+        // The side that creates the lane owns the files and removes them when it is closed.
+        uint32_t Create(const string& name);
+        uint32_t Attach(const string& name);
+        void Close();
+
+        // Returns false if the frame could not be written, it should be sent over the channel.
+        bool Write(const uint8_t frame[], const uint16_t length);
+
+    protected:
+        virtual void Received(const uint8_t frame[], const uint16_t length) = 0;
+
+    private:
+        uint32_t Open(const string& name, const bool create);
+        void Drain();
+        void Destroy();
+
+    private:
+        CriticalSection _lock;
+        string _name;
+        bool _owner;
+        Ring* _outbound;
+        Ring* _inbound;
+        std::atomic<bool> _open;
+        std::atomic<bool> _established;
+        uint8_t _frame[MaxFrameSize];
+    };
+}
+} // namespace Core
@@ -18,9 +18,17 @@
  */
 
 #include "JSON.h"
+#include <cerrno>
+#include <cmath>
 #include <iomanip>
 #include <sstream>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace WPEFramework {
 namespace Core {
     namespace JSON {
@@ -37,6 +45,710 @@ namespace Core {
         }
 
         /* static */ constexpr size_t Error::kContextMaxLength;
+        /* static */ constexpr uint8_t IMessagePack::NullValue;
+
+#if defined(__AVX2__)
+        typedef __m256i Vector;
+        #define VECTOR_LOAD(X) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(X))
+        #define VECTOR_SET(X) _mm256_set1_epi8(X)
+        #define VECTOR_EQUAL(X, Y) _mm256_cmpeq_epi8(X, Y)
+        #define VECTOR_OR(X, Y) _mm256_or_si256(X, Y)
+        #define VECTOR_SUB(X, Y) _mm256_sub_epi8(X, Y)
+        #define VECTOR_MAX(X, Y) _mm256_max_epu8(X, Y)
+        #define VECTOR_MASK(X) static_cast<uint32_t>(_mm256_movemask_epi8(X))
+        static constexpr uint16_t VectorSize = 32;
+        static constexpr uint32_t VectorMask = 0xFFFFFFFF;
+#elif defined(__SSE2__)
+        typedef __m128i Vector;
+        #define VECTOR_LOAD(X) _mm_loadu_si128(reinterpret_cast<const __m128i*>(X))
+        #define VECTOR_SET(X) _mm_set1_epi8(X)
+        #define VECTOR_EQUAL(X, Y) _mm_cmpeq_epi8(X, Y)
+        #define VECTOR_OR(X, Y) _mm_or_si128(X, Y)
+        #define VECTOR_SUB(X, Y) _mm_sub_epi8(X, Y)
+        #define VECTOR_MAX(X, Y) _mm_max_epu8(X, Y)
+        #define VECTOR_MASK(X) static_cast<uint32_t>(_mm_movemask_epi8(X))
+        static constexpr uint16_t VectorSize = 16;
+        static constexpr uint32_t VectorMask = 0xFFFF;
+#endif
+
+        /* static */ uint16_t Scanner::WhitespaceRun(const char stream[], const uint16_t length)
+        {
+            uint16_t result = 0;
+
+#ifdef VECTOR_LOAD
+            const Vector space = VECTOR_SET(' ');
+            const Vector tab = VECTOR_SET('\t');
+            const Vector range = VECTOR_SET('\r' - '\t');
+
+            while ((result + VectorSize) <= length) {
+                const Vector block = VECTOR_LOAD(&(stream[result]));
+
+                // A byte is \t..\r, if (byte - \t), unsigned, is not above (\r - \t).
+                const uint32_t mask = VECTOR_MASK(VECTOR_OR(VECTOR_EQUAL(block, space), VECTOR_EQUAL(VECTOR_MAX(VECTOR_SUB(block, tab), range), range)));
+
+                if (mask != VectorMask) {
+                    return (result + static_cast<uint16_t>(__builtin_ctz(~mask)));
+                }
+
+                result += VectorSize;
+            }
+#endif
+            while ((result < length) && (IsWhitespace(stream[result]) == true)) {
+                result++;
+            }
+
+            return (result);
+        }
+
+        /* static */ uint16_t Scanner::PlainRun(const char stream[], const uint16_t length)
+        {
+            uint16_t result = 0;
+
+#ifdef VECTOR_LOAD
+            const Vector quote = VECTOR_SET('\"');
+            const Vector backslash = VECTOR_SET('\\');
+
+            while ((result + VectorSize) <= length) {
+                const Vector block = VECTOR_LOAD(&(stream[result]));
+                const uint32_t mask = VECTOR_MASK(VECTOR_OR(VECTOR_EQUAL(block, quote), VECTOR_EQUAL(block, backslash)));
+
+                if (mask != 0) {
+                    return (result + static_cast<uint16_t>(__builtin_ctz(mask)));
+                }
+
+                result += VectorSize;
+            }
+#endif
+            while ((result < length) && (stream[result] != '\"') && (stream[result] != '\\')) {
+                result++;
+            }
+
+            return (result);
+        }
+
+        /* static */ uint16_t Scanner::OpaqueRun(const char stream[], const uint16_t length)
+        {
+            uint16_t result = 0;
+
+#ifdef VECTOR_LOAD
+            const Vector quote = VECTOR_SET('\"');
+            const Vector comma = VECTOR_SET(',');
+            const Vector curly = VECTOR_SET('{');
+            const Vector square = VECTOR_SET('[');
+            const Vector closing = VECTOR_SET(2);
+
+            while ((result + VectorSize) <= length) {
+                const Vector block = VECTOR_LOAD(&(stream[result]));
+
+                // Closing brackets are the opening ones + 2 (both for '{'/'}' and '['/']')
+                const Vector opening = VECTOR_SUB(block, closing);
+
+                const uint32_t mask = VECTOR_MASK(VECTOR_OR(
+                    VECTOR_OR(VECTOR_EQUAL(block, quote), VECTOR_EQUAL(block, comma)),
+                    VECTOR_OR(VECTOR_OR(VECTOR_EQUAL(block, curly), VECTOR_EQUAL(block, square)),
+                        VECTOR_OR(VECTOR_EQUAL(opening, curly), VECTOR_EQUAL(opening, square)))));
+
+                if (mask != 0) {
+                    return (result + static_cast<uint16_t>(__builtin_ctz(mask)));
+                }
+
+                result += VectorSize;
+            }
+#endif
+            while ((result < length) && (IsStructural(stream[result]) == false)) {
+                result++;
+            }
+
+            return (result);
+        }
+
+#ifdef VECTOR_LOAD
+        #undef VECTOR_LOAD
+        #undef VECTOR_SET
+        #undef VECTOR_EQUAL
+        #undef VECTOR_OR
+        #undef VECTOR_SUB
+        #undef VECTOR_MAX
+        #undef VECTOR_MASK
+#endif
+
+        static constexpr uint8_t MaximumDepth = 64;
+
+        static uint64_t BigEndian(const uint8_t stream[], const uint8_t size)
+        {
+            uint64_t result = 0;
+
+            for (uint8_t index = 0; index < size; index++) {
+                result = (result << 8) | stream[index];
+            }
+
+            return (result);
+        }
+
+        static void BigEndian(std::vector<uint8_t>& packed, const uint8_t header, const uint64_t value, const uint8_t size)
+        {
+            packed.push_back(header);
+
+            for (uint8_t index = size; index > 0; index--) {
+                packed.push_back(static_cast<uint8_t>(value >> (8 * (index - 1))));
+            }
+        }
+
+        static void Quote(const char stream[], const uint32_t length, string& text)
+        {
+            static const char hex[] = "0123456789ABCDEF";
+
+            text += '\"';
+
+            for (uint32_t index = 0; index < length; index++) {
+                const char character = stream[index];
+
+                if ((character == '\"') || (character == '\\')) {
+                    text += '\\';
+                    text += character;
+                } else if (static_cast<uint8_t>(character) >= 0x20) {
+                    text += character;
+                } else if (character == '\n') {
+                    text += _T("\\n");
+                } else if (character == '\r') {
+                    text += _T("\\r");
+                } else if (character == '\t') {
+                    text += _T("\\t");
+                } else if (character == '\b') {
+                    text += _T("\\b");
+                } else if (character == '\f') {
+                    text += _T("\\f");
+                } else {
+                    text += _T("\\u00");
+                    text += hex[(character >> 4) & 0x0F];
+                    text += hex[character & 0x0F];
+                }
+            }
+
+            text += '\"';
+        }
+
+        /* static */ uint32_t MessagePack::Length(const uint8_t stream[], const uint32_t length)
+        {
+            // Values still to come, the containers add their members to it.
+            uint64_t pending = 1;
+            uint64_t position = 0;
+
+            while (pending != 0) {
+                if (position >= length) {
+                    return (0);
+                }
+
+                const uint8_t header = stream[position];
+                uint8_t size = 0;
+                uint64_t payload = 0;
+
+                pending--;
+
+                if ((header <= 0x7F) || (header >= 0xE0) || ((header >= 0xC0) && (header <= 0xC3))) {
+                } else if (header <= 0x8F) {
+                    pending += 2 * (header & 0x0F);
+                } else if (header <= 0x9F) {
+                    pending += (header & 0x0F);
+                } else if (header <= 0xBF) {
+                    payload = (header & 0x1F);
+                } else if (header <= 0xC6) {
+                    size = static_cast<uint8_t>(1 << (header - 0xC4));
+                } else if (header <= 0xC9) {
+                    size = static_cast<uint8_t>(1 << (header - 0xC7));
+                    payload = 1;
+                } else if (header <= 0xD3) {
+                    payload = (header == 0xCA ? 4 : header == 0xCB ? 8 : (1 << ((header - 0xCC) & 0x03)));
+                } else if (header <= 0xD8) {
+                    payload = 1 + (1 << (header - 0xD4));
+                } else if (header <= 0xDB) {
+                    size = static_cast<uint8_t>(1 << (header - 0xD9));
+                } else {
+                    size = ((header & 0x01) == 0 ? 2 : 4);
+                }
+
+                position++;
+
+                if (size != 0) {
+                    if ((position + size) > length) {
+                        return (0);
+                    }
+
+                    const uint64_t count = BigEndian(&(stream[position]), size);
+
+                    if (header >= 0xDE) {
+                        pending += 2 * count;
+                    } else if (header >= 0xDC) {
+                        pending += count;
+                    } else {
+                        payload += count;
+                    }
+
+                    position += size;
+                }
+
+                position += payload;
+            }
+
+            return (position <= length ? static_cast<uint32_t>(position) : 0);
+        }
+
+        /* static */ bool MessagePack::ToText(const uint8_t stream[], const uint32_t length, string& text)
+        {
+            uint32_t position = 0;
+
+            text.clear();
+
+            return (Decode(stream, length, position, text, 0));
+        }
+
+        /* static */ bool MessagePack::FromText(const string& text, std::vector<uint8_t>& packed)
+        {
+            uint32_t position = 0;
+            const size_t start = packed.size();
+
+            bool result = Encode(text, position, packed, 0);
+
+            if (result == true) {
+                position += Scanner::Whitespace(&(text[position]), static_cast<uint16_t>(std::min(text.length() - position, static_cast<size_t>(0xFFFF))));
+                result = (position == text.length());
+            }
+
+            if (result == false) {
+                packed.resize(start);
+            }
+
+            return (result);
+        }
+
+        /* static */ bool MessagePack::Decode(const uint8_t stream[], const uint32_t length, uint32_t& position, string& text, const uint8_t depth)
+        {
+            if ((position >= length) || (depth == MaximumDepth)) {
+                return (false);
+            }
+
+            const uint8_t header = stream[position++];
+            const uint32_t available = length - position;
+            uint64_t count = 0;
+            bool map = false;
+            bool result = true;
+
+            if (header <= 0x7F) {
+                text += Core::NumberType<uint8_t>(header).Text();
+            } else if (header >= 0xE0) {
+                text += Core::NumberType<int8_t>(static_cast<int8_t>(header)).Text();
+            } else if (header <= 0x8F) {
+                count = (header & 0x0F);
+                map = true;
+            } else if (header <= 0x9F) {
+                count = (header & 0x0F);
+            } else if (header <= 0xBF) {
+                count = (header & 0x1F);
+                if (count > available) {
+                    return (false);
+                }
+                Quote(reinterpret_cast<const char*>(&(stream[position])), static_cast<uint32_t>(count), text);
+                position += static_cast<uint32_t>(count);
+                count = 0;
+            } else if (header == 0xC0) {
+                text += IElement::NullTag;
+            } else if (header == 0xC2) {
+                text += IElement::FalseTag;
+            } else if (header == 0xC3) {
+                text += IElement::TrueTag;
+            } else if ((header == 0xCA) || (header == 0xCB)) {
+                const uint8_t size = (header == 0xCA ? 4 : 8);
+                if (size > available) {
+                    return (false);
+                }
+
+                const uint64_t bits = BigEndian(&(stream[position]), size);
+                double value;
+                if (size == 4) {
+                    float single;
+                    const uint32_t half = static_cast<uint32_t>(bits);
+                    ::memcpy(&single, &half, sizeof(single));
+                    value = single;
+                } else {
+                    ::memcpy(&value, &bits, sizeof(value));
+                }
+                position += size;
+
+                if (std::isfinite(value) == false) {
+                    // JSON has no way to express these.
+                    text += IElement::NullTag;
+                } else {
+                    char buffer[32];
+                    ::snprintf(buffer, sizeof(buffer), (size == 4 ? "%.9g" : "%.17g"), value);
+                    text += buffer;
+                }
+            } else if ((header >= 0xCC) && (header <= 0xD3)) {
+                const uint8_t size = static_cast<uint8_t>(1 << ((header - 0xCC) & 0x03));
+                if (size > available) {
+                    return (false);
+                }
+
+                const uint64_t value = BigEndian(&(stream[position]), size);
+                position += size;
+
+                if (header <= 0xCF) {
+                    text += Core::NumberType<uint64_t>(value).Text();
+                } else {
+                    // Sign extend the smaller ones, the magnitude is printed unsigned so the lowest value fits as well.
+                    const uint8_t shift = static_cast<uint8_t>(64 - (8 * size));
+                    const int64_t number = static_cast<int64_t>(value << shift) >> shift;
+                    if (number < 0) {
+                        text += '-';
+                        text += Core::NumberType<uint64_t>(~static_cast<uint64_t>(number) + 1).Text();
+                    } else {
+                        text += Core::NumberType<uint64_t>(static_cast<uint64_t>(number)).Text();
+                    }
+                }
+            } else if (((header >= 0xD9) && (header <= 0xDB)) || ((header >= 0xC4) && (header <= 0xC6))) {
+                const uint8_t size = static_cast<uint8_t>(1 << (header >= 0xD9 ? header - 0xD9 : header - 0xC4));
+                if (size > available) {
+                    return (false);
+                }
+
+                count = BigEndian(&(stream[position]), size);
+                position += size;
+
+                if (count > (length - position)) {
+                    return (false);
+                }
+
+                if (header >= 0xD9) {
+                    Quote(reinterpret_cast<const char*>(&(stream[position])), static_cast<uint32_t>(count), text);
+                } else {
+                    // Binary data travels as base64 in JSON.
+                    string encoded;
+                    Core::ToString(&(stream[position]), static_cast<uint16_t>(std::min(count, static_cast<uint64_t>(0xFFFF))), true, encoded);
+                    Quote(encoded.c_str(), static_cast<uint32_t>(encoded.length()), text);
+                }
+                position += static_cast<uint32_t>(count);
+                count = 0;
+            } else if ((header >= 0xDC) && (header <= 0xDF)) {
+                const uint8_t size = ((header & 0x01) == 0 ? 2 : 4);
+                if (size > available) {
+                    return (false);
+                }
+
+                count = BigEndian(&(stream[position]), size);
+                map = (header >= 0xDE);
+                position += size;
+            } else {
+                // Extension types (and the never used 0xC1) have no JSON counterpart.
+                text += IElement::NullTag;
+                position = position - 1;
+                const uint32_t size = Length(&(stream[position]), length - position);
+                if (size == 0) {
+                    return (false);
+                }
+                position += size;
+            }
+
+            if (((header >= 0x80) && (header <= 0x9F)) || ((header >= 0xDC) && (header <= 0xDF))) {
+                text += (map == true ? '{' : '[');
+
+                for (uint64_t index = 0; (index < count) && (result == true); index++) {
+                    if (index != 0) {
+                        text += ',';
+                    }
+                    if (map == true) {
+                        const size_t start = text.length();
+
+                        result = Decode(stream, length, position, text, depth + 1);
+
+                        if ((result == true) && (text[start] != '\"')) {
+                            // JSON only knows labels that are strings.
+                            const string label(text.substr(start));
+                            text.resize(start);
+                            Quote(label.c_str(), static_cast<uint32_t>(label.length()), text);
+                        }
+
+                        text += ':';
+                    }
+                    if (result == true) {
+                        result = Decode(stream, length, position, text, depth + 1);
+                    }
+                }
+
+                text += (map == true ? '}' : ']');
+            }
+
+            return (result);
+        }
+
+        static bool Hexadecimal(const char character, uint32_t& value)
+        {
+            if ((character >= '0') && (character <= '9')) {
+                value = (value << 4) | (character - '0');
+            } else if ((character >= 'a') && (character <= 'f')) {
+                value = (value << 4) | (character - 'a' + 10);
+            } else if ((character >= 'A') && (character <= 'F')) {
+                value = (value << 4) | (character - 'A' + 10);
+            } else {
+                return (false);
+            }
+            return (true);
+        }
+
+        static bool Unescape(const string& text, uint32_t& position, string& value)
+        {
+            // Position is just after the opening quote.
+            while (position < text.length()) {
+                const char character = text[position++];
+
+                if (character == '\"') {
+                    return (true);
+                } else if (character != '\\') {
+                    value += character;
+                } else if (position < text.length()) {
+                    const char escaped = text[position++];
+
+                    switch (escaped) {
+                    case 'n': value += '\n'; break;
+                    case 'r': value += '\r'; break;
+                    case 't': value += '\t'; break;
+                    case 'b': value += '\b'; break;
+                    case 'f': value += '\f'; break;
+                    case 'u': {
+                        uint32_t code = 0;
+
+                        for (uint8_t index = 0; index < 4; index++) {
+                            if ((position >= text.length()) || (Hexadecimal(text[position++], code) == false)) {
+                                return (false);
+                            }
+                        }
+
+                        if ((code >= 0xD800) && (code <= 0xDBFF) && ((position + 6) <= text.length()) && (text[position] == '\\') && (text[position + 1] == 'u')) {
+                            uint32_t low = 0;
+                            uint32_t index = position + 2;
+
+                            while ((index < (position + 6)) && (Hexadecimal(text[index], low) == true)) {
+                                index++;
+                            }
+
+                            if ((index == (position + 6)) && (low >= 0xDC00) && (low <= 0xDFFF)) {
+                                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                                position += 6;
+                            }
+                        }
+
+                        // UTF-8 encode it.
+                        if (code < 0x80) {
+                            value += static_cast<char>(code);
+                        } else if (code < 0x800) {
+                            value += static_cast<char>(0xC0 | (code >> 6));
+                            value += static_cast<char>(0x80 | (code & 0x3F));
+                        } else if (code < 0x10000) {
+                            value += static_cast<char>(0xE0 | (code >> 12));
+                            value += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                            value += static_cast<char>(0x80 | (code & 0x3F));
+                        } else {
+                            value += static_cast<char>(0xF0 | (code >> 18));
+                            value += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+                            value += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+                            value += static_cast<char>(0x80 | (code & 0x3F));
+                        }
+                        break;
+                    }
+                    default:
+                        // \" \\ \/ and whatever else is escaped, is the character itself.
+                        value += escaped;
+                        break;
+                    }
+                }
+            }
+
+            return (false);
+        }
+
+        static void Header(std::vector<uint8_t>& packed, const size_t at, const uint64_t count, const bool map)
+        {
+            // One byte got reserved up front, for the (most likely) short form.
+            if (count <= 15) {
+                packed[at] = static_cast<uint8_t>((map == true ? 0x80 : 0x90) | count);
+            } else {
+                const uint8_t size = (count <= 0xFFFF ? 2 : 4);
+                std::vector<uint8_t> header;
+
+                BigEndian(header, static_cast<uint8_t>((map == true ? 0xDE : 0xDC) | (size == 2 ? 0x00 : 0x01)), count, size);
+
+                packed[at] = header[0];
+                packed.insert(packed.begin() + at + 1, header.begin() + 1, header.end());
+            }
+        }
+
+        static void Pack(std::vector<uint8_t>& packed, const string& value)
+        {
+            const uint64_t length = value.length();
+
+            if (length <= 31) {
+                packed.push_back(static_cast<uint8_t>(0xA0 | length));
+            } else if (length <= 0xFF) {
+                BigEndian(packed, 0xD9, length, 1);
+            } else if (length <= 0xFFFF) {
+                BigEndian(packed, 0xDA, length, 2);
+            } else {
+                BigEndian(packed, 0xDB, length, 4);
+            }
+
+            packed.insert(packed.end(), value.begin(), value.end());
+        }
+
+        /* static */ bool MessagePack::Encode(const string& text, uint32_t& position, std::vector<uint8_t>& packed, const uint8_t depth)
+        {
+            const uint32_t length = static_cast<uint32_t>(text.length());
+
+            while ((position < length) && (Scanner::IsWhitespace(text[position]) == true)) {
+                position++;
+            }
+
+            if ((position == length) || (depth == MaximumDepth)) {
+                return (false);
+            }
+
+            const char character = text[position];
+            bool result = true;
+
+            if ((character == '{') || (character == '[')) {
+                const bool map = (character == '{');
+                const char closing = (map == true ? '}' : ']');
+                const size_t at = packed.size();
+                uint64_t count = 0;
+                bool next = true;
+
+                packed.push_back(0);
+                position++;
+
+                while ((result == true) && (next == true)) {
+                    while ((position < length) && (Scanner::IsWhitespace(text[position]) == true)) {
+                        position++;
+                    }
+
+                    if (position == length) {
+                        result = false;
+                    } else if ((text[position] == closing) && (count == 0)) {
+                        next = false;
+                    } else {
+                        if (map == true) {
+                            string label;
+
+                            result = (text[position++] == '\"') && (Unescape(text, position, label) == true);
+
+                            while ((result == true) && (position < length) && (Scanner::IsWhitespace(text[position]) == true)) {
+                                position++;
+                            }
+
+                            result = (result == true) && (position < length) && (text[position++] == ':');
+
+                            if (result == true) {
+                                Pack(packed, label);
+                            }
+                        }
+
+                        result = (result == true) && (Encode(text, position, packed, depth + 1) == true);
+
+                        while ((result == true) && (position < length) && (Scanner::IsWhitespace(text[position]) == true)) {
+                            position++;
+                        }
+
+                        if ((result == true) && (position < length)) {
+                            count++;
+                            next = (text[position] == ',');
+                            if (next == true) {
+                                position++;
+                            }
+                        } else {
+                            result = false;
+                        }
+                    }
+                }
+
+                if (result == true) {
+                    result = (text[position++] == closing);
+                    Header(packed, at, count, map);
+                }
+            } else if (character == '\"') {
+                string value;
+
+                position++;
+                result = Unescape(text, position, value);
+                Pack(packed, value);
+            } else if (text.compare(position, 4, IElement::NullTag) == 0) {
+                packed.push_back(IMessagePack::NullValue);
+                position += 4;
+            } else if (text.compare(position, 4, IElement::TrueTag) == 0) {
+                packed.push_back(0xC3);
+                position += 4;
+            } else if (text.compare(position, 5, IElement::FalseTag) == 0) {
+                packed.push_back(0xC2);
+                position += 5;
+            } else if ((character == '-') || ((character >= '0') && (character <= '9'))) {
+                const char* start = &(text[position]);
+                char* end = nullptr;
+                bool fraction = false;
+                uint32_t index = position + 1;
+
+                while ((index < length) && ((::isdigit(text[index]) != 0) || (text[index] == '.') || (text[index] == 'e') || (text[index] == 'E') || (text[index] == '+') || (text[index] == '-'))) {
+                    fraction = fraction || (::isdigit(text[index]) == 0);
+                    index++;
+                }
+
+                errno = 0;
+
+                if ((fraction == false) && (character == '-')) {
+                    const int64_t value = ::strtoll(start, &end, 10);
+
+                    if (errno == ERANGE) {
+                        fraction = true;
+                    } else if (value >= -32) {
+                        packed.push_back(static_cast<uint8_t>(value));
+                    } else if (value >= INT8_MIN) {
+                        BigEndian(packed, 0xD0, static_cast<uint64_t>(value), 1);
+                    } else if (value >= INT16_MIN) {
+                        BigEndian(packed, 0xD1, static_cast<uint64_t>(value), 2);
+                    } else if (value >= INT32_MIN) {
+                        BigEndian(packed, 0xD2, static_cast<uint64_t>(value), 4);
+                    } else {
+                        BigEndian(packed, 0xD3, static_cast<uint64_t>(value), 8);
+                    }
+                } else if (fraction == false) {
+                    const uint64_t value = ::strtoull(start, &end, 10);
+
+                    if (errno == ERANGE) {
+                        fraction = true;
+                    } else if (value <= 0x7F) {
+                        packed.push_back(static_cast<uint8_t>(value));
+                    } else if (value <= 0xFF) {
+                        BigEndian(packed, 0xCC, value, 1);
+                    } else if (value <= 0xFFFF) {
+                        BigEndian(packed, 0xCD, value, 2);
+                    } else if (value <= 0xFFFFFFFF) {
+                        BigEndian(packed, 0xCE, value, 4);
+                    } else {
+                        BigEndian(packed, 0xCF, value, 8);
+                    }
+                }
+
+                if (fraction == true) {
+                    // Not an integer (or too big to be one), so a double it is.
+                    const double value = ::strtod(start, &end);
+                    uint64_t bits;
+
+                    ::memcpy(&bits, &value, sizeof(bits));
+                    BigEndian(packed, 0xCB, bits, 8);
+                }
+
+                result = (end == &(text[index]));
+                position = index;
+            } else {
+                result = false;
+            }
+
+            return (result);
+        }
 
         /* static */ char IElement::NullTag[5] = { 'n', 'u', 'l', 'l', '\0' };
         /* static */ char IElement::TrueTag[5] = { 't', 'r', 'u', 'e', '\0' };
@@ -83,6 +83,52 @@ namespace Core {
 
         string EXTERNAL ErrorDisplayMessage(const Error& err);
 
+        // The deserializers look at the text one character at a time. Most of these characters need no
+        // attention at all: whitespace between the tokens and the plain content of strings. The scanner
+        // tells how many of them there are, so they can be skipped (or copied) in one go. The runs are
+        // found 16 (SSE2) or 32 (AVX2) characters at a time, if the target supports it.
+        struct EXTERNAL Scanner {
+            Scanner() = delete;
+            Scanner(const Scanner&) = delete;
+            Scanner& operator=(const Scanner&) = delete;
+
+            // Number of whitespace characters the stream starts with.
+            static inline uint16_t Whitespace(const char stream[], const uint16_t length)
+            {
+                // Mostly, there is no whitespace, or just one, so do not bother the vector unit for that.
+                return ((length == 0) || (IsWhitespace(stream[0]) == false) ? 0 : (((length == 1) || (IsWhitespace(stream[1]) == false)) ? 1 : 2 + WhitespaceRun(&(stream[2]), length - 2)));
+            }
+
+            // Number of characters the stream starts with, that are not a quote or a backslash. These
+            // can be taken as is into the value of a string.
+            static inline uint16_t Plain(const char stream[], const uint16_t length)
+            {
+                return ((length == 0) || (stream[0] == '\"') || (stream[0] == '\\') ? 0 : 1 + PlainRun(&(stream[1]), length - 1));
+            }
+
+            // Number of characters the stream starts with, that are not a quote, a comma or an opening
+            // or closing bracket. These can be taken as is into an opaque value.
+            static inline uint16_t Opaque(const char stream[], const uint16_t length)
+            {
+                return ((length == 0) || (IsStructural(stream[0]) == true) ? 0 : 1 + OpaqueRun(&(stream[1]), length - 1));
+            }
+
+            static inline bool IsWhitespace(const char character)
+            {
+                // Same set as ::isspace in the "C" locale.
+                return ((character == ' ') || (static_cast<uint8_t>(static_cast<uint8_t>(character) - '\t') <= ('\r' - '\t')));
+            }
+            static inline bool IsStructural(const char character)
+            {
+                return ((character == '\"') || (character == ',') || (character == '{') || (character == '}') || (character == '[') || (character == ']'));
+            }
+
+        private:
+            static uint16_t WhitespaceRun(const char stream[], const uint16_t length);
+            static uint16_t PlainRun(const char stream[], const uint16_t length);
+            static uint16_t OpaqueRun(const char stream[], const uint16_t length);
+        };
+
         struct EXTERNAL IElement {
 
             static TCHAR NullTag[5];
@@ -91,25 +137,36 @@ namespace Core {
 
             virtual ~IElement() = default;
 
+            static constexpr uint16_t MinimumTextSize = 256;
+
             template <typename INSTANCEOBJECT>
             static bool ToString(const INSTANCEOBJECT& realObject, string& text)
             {
-                char buffer[1024];
                 uint16_t loaded;
+                uint16_t space;
                 uint32_t offset = 0;
+                size_t length = 0;
 
-                text.clear();
+                // Serialize straight into the text. What it could hold before, is a fair estimate of what
+                // it needs now, so if it is reused, it mostly does not have to grow at all.
+                text.resize(std::max(text.capacity(), static_cast<size_t>(MinimumTextSize)));
 
                 // Serialize object
                 do {
-                    loaded = static_cast<const IElement&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                    if (length == text.length()) {
+                        text.resize(2 * length);
+                    }
 
-                    ASSERT(loaded <= sizeof(buffer));
-                    DEBUG_VARIABLE(loaded);
+                    space = static_cast<uint16_t>(std::min(text.length() - length, static_cast<size_t>(0xFFFF)));
+                    loaded = static_cast<const IElement&>(realObject).Serialize(&(text[length]), space, offset);
+
+                    ASSERT(loaded <= space);
 
-                    text += string(buffer, loaded);
+                    length += loaded;
 
-                } while ((offset != 0) && (loaded == sizeof(buffer)));
+                } while ((offset != 0) && (loaded == space));
+
+                text.resize(length);
 
                 return (offset == 0);
             }
@@ -296,21 +353,30 @@ namespace Core {
             template <typename INSTANCEOBJECT>
             static bool ToBuffer(std::vector<uint8_t>& stream, const INSTANCEOBJECT& realObject)
             {
-                uint8_t buffer[1024];
                 uint16_t loaded;
+                uint16_t space;
                 uint32_t offset = 0;
+                size_t length = 0;
+
+                // Same as IElement::ToString, straight into the stream, it's capacity being the estimate.
+                stream.resize(std::max(stream.capacity(), static_cast<size_t>(IElement::MinimumTextSize)));
 
-                stream.clear();
                 // Serialize object
                 do {
-                    loaded = static_cast<const IMessagePack&>(realObject).Serialize(buffer, sizeof(buffer), offset);
+                    if (length == stream.size()) {
+                        stream.resize(2 * length);
+                    }
 
-                    ASSERT(loaded <= sizeof(buffer));
-                    DEBUG_VARIABLE(loaded);
+                    space = static_cast<uint16_t>(std::min(stream.size() - length, static_cast<size_t>(0xFFFF)));
+                    loaded = static_cast<const IMessagePack&>(realObject).Serialize(&(stream[length]), space, offset);
 
-                    stream.reserve(stream.size() + loaded);
-                    stream.insert(stream.end(), buffer, buffer + loaded);
-                } while ((offset != 0) && (loaded == sizeof(buffer)));
+                    ASSERT(loaded <= space);
+
+                    length += loaded;
+
+                } while ((offset != 0) && (loaded == space));
+
+                stream.resize(length);
 
                 return (offset == 0);
             }
@@ -437,6 +503,28 @@ namespace Core {
             virtual uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) = 0;
         };
 
+        // Some values are kept as JSON text, like the (opaque) parameters and result of a JSON-RPC
+        // message. In MessagePack these travel as the values they describe, not as a string holding
+        // the text. These are the conversions between the two.
+        struct EXTERNAL MessagePack {
+            MessagePack() = delete;
+            MessagePack(const MessagePack&) = delete;
+            MessagePack& operator=(const MessagePack&) = delete;
+
+            // Number of bytes of the value the stream starts with, 0 if the stream does not hold all of it (yet).
+            static uint32_t Length(const uint8_t stream[], const uint32_t length);
+
+            // JSON text of the value the stream starts with.
+            static bool ToText(const uint8_t stream[], const uint32_t length, string& text);
+
+            // The value described by the JSON text, appended to the packed bytes.
+            static bool FromText(const string& text, std::vector<uint8_t>& packed);
+
+        private:
+            static bool Decode(const uint8_t stream[], const uint32_t length, uint32_t& position, string& text, const uint8_t depth);
+            static bool Encode(const string& text, uint32_t& position, std::vector<uint8_t>& packed, const uint8_t depth);
+        };
+
         enum class ValueValidity : int8_t {
             IS_NULL,
             UNKNOWN,
@@ -777,7 +865,7 @@ namespace Core {
 
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, uint32_t& offset) override
             {
-                uint8_t loaded = 0;
+                uint16_t loaded = 0;
                 if (offset == 0) {
                     // First byte depicts a lot. Find out what we need to read
                     _value = 0;
@@ -789,27 +877,37 @@ namespace Core {
                         _set = (1 << (header - 0xCC)) << 12;
                         offset = 1;
                     } else if ((header >= 0xD0) && (header <= 0xD3)) {
-                        _set = (1 << (header - 0xD0)) << 12;
+                        // Signed, the value needs to be sign extended if it is smaller than we are.
+                        _set = ((1 << (header - 0xD0)) << 12) | NEGATIVE;
                         offset = 1;
                     } else if ((header & 0x80) == 0) {
-                        _value = (header & 0x7F);
+                        _value = static_cast<TYPE>(header);
+                        _set = SET;
                     } else if ((header & 0xE0) == 0xE0) {
-                        _value = (header & 0x0F);
-                        _set = NEGATIVE;
+                        _value = static_cast<TYPE>(static_cast<int8_t>(header));
+                        _set = SET;
                     } else {
                         _set = ERROR;
                     }
                 }
 
                 while ((loaded < maxLength) && (offset != 0)) {
-                    _value = _value << 8;
-                    _value += stream[loaded++];
-                    offset = (offset == ((_set >> 12) & 0xF) ? 0 : offset + 1);
-                }
+                    const uint8_t size = ((_set >> 12) & 0xF);
 
-                if (_value != 0) {
-                    _set |= SET;
+                    _value = static_cast<TYPE>((static_cast<uint64_t>(_value) << 8) | stream[loaded++]);
+
+                    if (offset == size) {
+                        if (((_set & NEGATIVE) != 0) && (size < sizeof(TYPE))) {
+                            const uint8_t shift = static_cast<uint8_t>(64 - (8 * size));
+                            _value = static_cast<TYPE>(static_cast<int64_t>(static_cast<uint64_t>(_value) << shift) >> shift);
+                        }
+                        _set = SET;
+                        offset = 0;
+                    } else {
+                        offset++;
+                    }
                 }
+
                 return (loaded);
             }
 
@@ -860,80 +958,37 @@ namespace Core {
 
             uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint32_t& offset, const TemplateIntToType<false>& /* For compile time diffrentiation */) const
             {
-                uint8_t loaded = 0;
-                uint8_t bytes = (_value <= 0x7F ? 0 : _value < 0xFF ? 1 : _value < 0xFFFF ? 2 : _value < 0xFFFFFFFF ? 4 : 8);
+                const uint64_t value = static_cast<uint64_t>(_value);
+                const uint8_t bytes = (value <= 0x7F ? 0 : value <= 0xFF ? 1 : value <= 0xFFFF ? 2 : value <= 0xFFFFFFFF ? 4 : 8);
 
-                if (offset == 0) {
-                    if (bytes == 0) {
-                        if (_value != 0) {
-                            stream[loaded++] = static_cast<uint8_t>(_value);
-                        } else {
-                            stream[loaded++] = IMessagePack::NullValue;
-                        }
-                    } else {
-                        switch (bytes) {
-                        case 1:
-                            stream[loaded++] = 0xCC;
-                            break;
-                        case 2:
-                            stream[loaded++] = 0xCD;
-                            break;
-                        case 4:
-                            stream[loaded++] = 0xCE;
-                            break;
-                        case 8:
-                            stream[loaded++] = 0xCF;
-                            break;
-                        default:
-                            ASSERT(false);
-                        }
-                        offset = 1;
-                    }
-                }
+                return (Convert(stream, maxLength, offset, (bytes == 0 ? static_cast<uint8_t>(value) : bytes == 1 ? 0xCC : bytes == 2 ? 0xCD : bytes == 4 ? 0xCE : 0xCF), bytes));
+            }
 
-                while ((loaded < maxLength) && (offset != 0)) {
-                    TYPE value = _value >> (8 * (bytes - offset));
+            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
+            {
+                const int64_t value = static_cast<int64_t>(_value);
 
-                    stream[loaded++] = static_cast<uint8_t>(value & 0xFF);
-                    offset = (offset == bytes ? 0 : offset + 1);
+                if (value >= 0) {
+                    return (Convert(stream, maxLength, offset, TemplateIntToType<false>()));
                 }
 
-                return (loaded);
+                const uint8_t bytes = (value >= -32 ? 0 : value >= INT8_MIN ? 1 : value >= INT16_MIN ? 2 : value >= INT32_MIN ? 4 : 8);
+
+                return (Convert(stream, maxLength, offset, (bytes == 0 ? static_cast<uint8_t>(value) : bytes == 1 ? 0xD0 : bytes == 2 ? 0xD1 : bytes == 4 ? 0xD2 : 0xD3), bytes));
             }
 
-            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint32_t& offset, const TemplateIntToType<true>& /* For c ompile time diffrentiation */) const
+            // The header, followed by the number of value bytes (big endian), if the header is not the value itself.
+            uint16_t Convert(uint8_t stream[], const uint16_t maxLength, uint32_t& offset, const uint8_t header, const uint8_t bytes) const
             {
-                uint8_t loaded = 0;
-                uint8_t bytes = (((_value < 16) && (_value > -15)) ? 0 : ((_value < 128) && (_value > -127)) ? 1 : ((_value < 32767) && (_value > -32766)) ? 2 : ((_value < 2147483647) && (_value > -2147483646)) ? 4 : 8);
+                uint16_t loaded = 0;
 
                 if (offset == 0) {
-                    if (bytes == 0) {
-                        stream[loaded++] = (_value & 0x1F) | 0xE0;
-                    } else {
-                        switch (bytes) {
-                        case 1:
-                            stream[loaded++] = 0xD0;
-                            break;
-                        case 2:
-                            stream[loaded++] = 0xD1;
-                            break;
-                        case 4:
-                            stream[loaded++] = 0xD2;
-                            break;
-                        case 8:
-                            stream[loaded++] = 0xD3;
-                            break;
-                        default:
-                            ASSERT(false);
-                        }
-                        offset = 1;
-                    }
+                    stream[loaded++] = header;
+                    offset = (bytes == 0 ? 0 : 1);
                 }
 
                 while ((loaded < maxLength) && (offset != 0)) {
-                    TYPE value = _value >> (8 * (bytes - offset));
-
-                    stream[loaded++] = static_cast<uint8_t>(value & 0xFF);
+                    stream[loaded++] = static_cast<uint8_t>(static_cast<uint64_t>(_value) >> (8 * (bytes - offset)));
                     offset = (offset == bytes ? 0 : offset + 1);
                 }
 
@@ -1478,6 +1533,9 @@ namespace Core {
             static constexpr uint16_t NullBit = 0x4000;
             static constexpr uint16_t SetBit = 0x8000;
 
+            // MessagePack offsets with this bit set, are about a value that is not a string.
+            static constexpr uint32_t PackedValue = 0x40000000;
+
             enum class ScopeBracket : uint8_t {
                 CURLY_BRACKET = 0,
                 SQUARE_BRACKET = 1
@@ -1557,6 +1615,15 @@ namespace Core {
             }
 #endif // __CORE_NO_WCHAR_SUPPORT__
 
+            // Take over a (serialized) text as is, without copying it.
+            String& operator=(std::string&& RHS)
+            {
+                _value = std::move(RHS);
+                _flagsAndCounters |= SetBit;
+
+                return (*this);
+            }
+
             String& operator=(const String& RHS)
             {
                 _default = RHS._default;
@@ -1633,6 +1700,13 @@ namespace Core {
                 return (_default);
             }
 
+            // The content as it was received, without making a copy of it. A string that came in
+            // quoted, while we are not (opaque), lacks its quotes here, use Value() for those.
+            inline const string& Opaque() const
+            {
+                return (((_flagsAndCounters & (SetBit | NullBit)) == SetBit) ? _value : _default);
+            }
+
             void Null(const bool enabled)
             {
                 if (enabled == true) {
@@ -1886,15 +1960,22 @@ namespace Core {
                         }
 
                         if (finished == false) {
-                            // Write the amount we possibly can..
-                            _value += current;
+                            if (Scanner::IsStructural(current) == false) {
+                                // Nothing in here changes the scope, write the amount we possibly can..
+                                const uint16_t opaque = Scanner::Opaque(&(stream[result]), maxLength - result);
+                                _value.append(&(stream[result]), opaque);
+                                result += opaque;
+                            } else {
+                                // Write the amount we possibly can..
+                                _value += current;
 
-                            if ((current == '\"') && ((_value.empty() == true) || (_value[_value.length() - 1] != '\\'))) {
-                                // Oke we are going to enetr a Serialized thingy... lets be opaque from here on
-                                _flagsAndCounters ^= EscapeFoundBit;
-                            }
+                                if ((current == '\"') && ((_value.empty() == true) || (_value[_value.length() - 1] != '\\'))) {
+                                    // Oke we are going to enetr a Serialized thingy... lets be opaque from here on
+                                    _flagsAndCounters ^= EscapeFoundBit;
+                                }
 
-                            result++;
+                                result++;
+                            }
                         }
                     }
                     // Since it is a "real" string translate back all escaped stuff.. are we in an unescaping mode?
@@ -1909,8 +1990,10 @@ namespace Core {
                             finished = true;
                         }
                         else {
-                            // Just copy, we and onto the next;
-                            _value += current;
+                            // Just copy, all up to the next quote or escape, and onto the next;
+                            const uint16_t plain = Scanner::Plain(&(stream[result]), maxLength - result);
+                            _value.append(&(stream[result]), plain);
+                            result += (plain - 1);
                         }
                         result++;
                     }
@@ -1995,7 +2078,17 @@ namespace Core {
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
             {
                 uint16_t loaded = 0;
-                if (offset == 0) {
+                std::vector<uint8_t> packed;
+
+                if (((offset == 0) || ((offset & PackedValue) != 0)) && ((_flagsAndCounters & (QuotedSerializeBit | NullBit)) == 0) && (MessagePack::FromText(_value, packed) == true)) {
+                    // Opaque JSON text goes out as the value it describes, not as a string.
+                    const uint32_t position = (offset & (~PackedValue));
+
+                    loaded = static_cast<uint16_t>(std::min(static_cast<size_t>(maxLength), packed.size() - position));
+                    ::memcpy(stream, &(packed[position]), loaded);
+
+                    offset = ((position + loaded) == packed.size() ? 0 : (PackedValue | (position + loaded)));
+                } else if (offset == 0) {
                     if ((_flagsAndCounters & NullBit) != 0) {
                         stream[loaded++] = IMessagePack::NullValue;
                     } else if (_value.length() <= 31) {
@@ -2015,7 +2108,7 @@ namespace Core {
                     }
                 }
 
-                if (offset != 0) {
+                if ((offset != 0) && ((offset & PackedValue) == 0)) {
                     while ((loaded < maxLength) && (offset < (_storage & 0x0F))) {
                         stream[loaded++] = static_cast<uint8_t>((_value.length() >> (8 * ( (_storage & 0x0F) - offset - 1))) & 0xFF);
                         offset++;
@@ -2048,7 +2141,7 @@ namespace Core {
                     if (stream[loaded] == IMessagePack::NullValue) {
                         _flagsAndCounters |= NullBit;
                         loaded++;
-                    } else if ((stream[loaded] & 0xA0) == 0xA0) {
+                    } else if ((stream[loaded] & 0xE0) == 0xA0) {
                         _storage = stream[loaded] & 0x1F;
                         offset = 3;
                         loaded++;
@@ -2061,11 +2154,32 @@ namespace Core {
                         offset = 1;
                         loaded++;
                     } else {
-                        loaded = maxLength;
+                        // Any other value is taken as the JSON text describing it.
+                        offset = PackedValue;
                     }
                 }
 
-                if (offset != 0) {
+                if ((offset & PackedValue) != 0) {
+                    // Collect the bytes till the value is complete, the stream might hold more than just this value.
+                    const uint32_t kept = static_cast<uint32_t>(_value.length());
+
+                    _value.append(reinterpret_cast<const char*>(&(stream[loaded])), maxLength - loaded);
+
+                    const uint32_t size = MessagePack::Length(reinterpret_cast<const uint8_t*>(_value.data()), static_cast<uint32_t>(_value.length()));
+
+                    if (size == 0) {
+                        loaded = maxLength;
+                    } else {
+                        string text;
+
+                        MessagePack::ToText(reinterpret_cast<const uint8_t*>(_value.data()), size, text);
+
+                        loaded += static_cast<uint16_t>(size - kept);
+                        _value = std::move(text);
+                        _flagsAndCounters |= SetBit;
+                        offset = 0;
+                    }
+                } else if (offset != 0) {
                     while ((loaded < maxLength) && (offset < 3)) {
                         _storage = (_storage << 8) + stream[loaded++];
                         offset++;
@@ -2626,11 +2740,265 @@ namespace Core {
             static constexpr uint16_t SKIP_AFTER = 4;
             static constexpr uint16_t PARSE = 5;
 
+
+            // Elements are kept in chunks that double in size. An element never moves once it is
+            // added, so the references handed out by Add() stay valid, while growing takes a
+            // logarithmic number of allocations and walking the array walks consecutive memory.
+            template <typename ARRAYELEMENT>
+            class StorageType {
+            private:
+                static constexpr uint32_t FIRST_CHUNK = 4;
+
+                template <typename VALUE>
+                class LocatorType {
+                private:
+                    typedef typename std::conditional<std::is_const<VALUE>::value, const StorageType<ARRAYELEMENT>, StorageType<ARRAYELEMENT>>::type Storage;
+
+                public:
+                    LocatorType()
+                        : _storage(nullptr)
+                        , _index(0)
+                        , _chunk(0)
+                        , _offset(0)
+                        , _element(nullptr)
+                    {
+                    }
+                    LocatorType(Storage& storage, const uint32_t index, const uint32_t chunk, const uint32_t offset)
+                        : _storage(&storage)
+                        , _index(index)
+                        , _chunk(chunk)
+                        , _offset(offset)
+                        , _element(nullptr)
+                    {
+                    }
+                    LocatorType(const LocatorType<VALUE>&) = default;
+                    LocatorType<VALUE>& operator=(const LocatorType<VALUE>&) = default;
+                    ~LocatorType() = default;
+
+                public:
+                    inline bool operator==(const LocatorType<VALUE>& RHS) const
+                    {
+                        return ((_storage == RHS._storage) && (_index == RHS._index));
+                    }
+                    inline bool operator!=(const LocatorType<VALUE>& RHS) const
+                    {
+                        return (!operator==(RHS));
+                    }
+                    inline LocatorType<VALUE>& operator++()
+                    {
+                        _index++;
+                        if (++_offset == Capacity(_chunk)) {
+                            _chunk++;
+                            _offset = 0;
+                            _element = nullptr;
+                        } else if (_element != nullptr) {
+                            _element++;
+                        }
+                        return (*this);
+                    }
+                    inline LocatorType<VALUE> operator++(int)
+                    {
+                        LocatorType<VALUE> result(*this);
+                        operator++();
+                        return (result);
+                    }
+                    inline VALUE& operator*() const
+                    {
+                        ASSERT((_storage != nullptr) && (_index < _storage->_size));
+
+                        // The chunk might not have existed yet when the locator got there.
+                        if (_element == nullptr) {
+                            _element = &(_storage->_chunks[_chunk][_offset]);
+                        }
+
+                        return (*_element);
+                    }
+                    inline VALUE* operator->() const
+                    {
+                        return (&(operator*()));
+                    }
+
+                private:
+                    Storage* _storage;
+                    uint32_t _index;
+                    uint32_t _chunk;
+                    uint32_t _offset;
+                    mutable VALUE* _element;
+                };
+
+            public:
+                typedef LocatorType<ARRAYELEMENT> iterator;
+                typedef LocatorType<const ARRAYELEMENT> const_iterator;
+
+                StorageType()
+                    : _chunks()
+                    , _size(0)
+                    , _chunk(0)
+                    , _offset(0)
+                {
+                }
+                StorageType(const StorageType<ARRAYELEMENT>& copy)
+                    : _chunks()
+                    , _size(0)
+                    , _chunk(0)
+                    , _offset(0)
+                {
+                    Append(copy);
+                }
+                ~StorageType()
+                {
+                    clear();
+
+                    for (ARRAYELEMENT* chunk : _chunks) {
+                        ::operator delete(chunk);
+                    }
+                }
+
+                StorageType<ARRAYELEMENT>& operator=(const StorageType<ARRAYELEMENT>& RHS)
+                {
+                    if (&RHS != this) {
+                        clear();
+                        Append(RHS);
+                    }
+
+                    return (*this);
+                }
+
+            public:
+                inline uint32_t size() const
+                {
+                    return (_size);
+                }
+                inline bool empty() const
+                {
+                    return (_size == 0);
+                }
+                inline iterator begin()
+                {
+                    return (iterator(*this, 0, 0, 0));
+                }
+                inline iterator end()
+                {
+                    return (iterator(*this, _size, _chunk, _offset));
+                }
+                inline const_iterator begin() const
+                {
+                    return (const_iterator(*this, 0, 0, 0));
+                }
+                inline const_iterator end() const
+                {
+                    return (const_iterator(*this, _size, _chunk, _offset));
+                }
+                ARRAYELEMENT& operator[](const uint32_t index)
+                {
+                    uint32_t chunk, offset;
+
+                    ASSERT(index < _size);
+
+                    Position(index, chunk, offset);
+
+                    return (_chunks[chunk][offset]);
+                }
+                const ARRAYELEMENT& operator[](const uint32_t index) const
+                {
+                    uint32_t chunk, offset;
+
+                    ASSERT(index < _size);
+
+                    Position(index, chunk, offset);
+
+                    return (_chunks[chunk][offset]);
+                }
+                inline ARRAYELEMENT& back()
+                {
+                    return (operator[](_size - 1));
+                }
+                inline const ARRAYELEMENT& back() const
+                {
+                    return (operator[](_size - 1));
+                }
+                template <typename... Args>
+                ARRAYELEMENT& emplace_back(Args&&... args)
+                {
+                    if (_chunk == _chunks.size()) {
+                        _chunks.push_back(static_cast<ARRAYELEMENT*>(::operator new(Capacity(_chunk) * sizeof(ARRAYELEMENT))));
+                    }
+
+                    ARRAYELEMENT* element = new (&(_chunks[_chunk][_offset])) ARRAYELEMENT(std::forward<Args>(args)...);
+
+                    _size++;
+                    if (++_offset == Capacity(_chunk)) {
+                        _chunk++;
+                        _offset = 0;
+                    }
+
+                    return (*element);
+                }
+                inline void push_back(const ARRAYELEMENT& element)
+                {
+                    emplace_back(element);
+                }
+                // The chunks are kept, a cleared array is typically filled again.
+                void clear()
+                {
+                    uint32_t chunk = 0;
+                    uint32_t offset = 0;
+
+                    for (uint32_t index = 0; index < _size; index++) {
+                        _chunks[chunk][offset].~ARRAYELEMENT();
+
+                        if (++offset == Capacity(chunk)) {
+                            chunk++;
+                            offset = 0;
+                        }
+                    }
+
+                    _size = 0;
+                    _chunk = 0;
+                    _offset = 0;
+                }
+
+            private:
+                void Append(const StorageType<ARRAYELEMENT>& source)
+                {
+                    for (const ARRAYELEMENT& element : source) {
+                        emplace_back(element);
+                    }
+                }
+                static inline uint32_t Capacity(const uint32_t chunk)
+                {
+                    return (chunk == 0 ? FIRST_CHUNK : (FIRST_CHUNK << (chunk - 1)));
+                }
+                static void Position(const uint32_t index, uint32_t& chunk, uint32_t& offset)
+                {
+                    uint32_t start = FIRST_CHUNK;
+
+                    if (index < start) {
+                        chunk = 0;
+                        offset = index;
+                    } else {
+                        chunk = 1;
+                        while ((index - start) >= start) {
+                            start <<= 1;
+                            chunk++;
+                        }
+                        offset = index - start;
+                    }
+                }
+
+            private:
+                std::vector<ARRAYELEMENT*> _chunks;
+                uint32_t _size;
+                // Where the next element goes.
+                uint32_t _chunk;
+                uint32_t _offset;
+            };
+
         public:
             template <typename ARRAYELEMENT>
             class ConstIteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef StorageType<ARRAYELEMENT> ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -2745,7 +3113,7 @@ namespace Core {
             template <typename ARRAYELEMENT>
             class IteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef StorageType<ARRAYELEMENT> ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -2915,50 +3283,26 @@ namespace Core {
 
             inline ELEMENT& Add()
             {
-                _data.push_back(ELEMENT());
-
-                return (_data.back());
+                return (_data.emplace_back());
             }
 
             inline ELEMENT& Add(const ELEMENT& element)
             {
-                _data.push_back(element);
-
-                return (_data.back());
+                return (_data.emplace_back(element));
             }
 
             ELEMENT& operator[](const uint32_t index)
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
-
-                ASSERT(locator != _data.end());
-
-                return (*locator);
+                return (_data[index]);
             }
 
             const ELEMENT& operator[](const uint32_t index) const
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::const_iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
-
-                ASSERT(locator != _data.end());
-
-                return (*locator);
+                return (_data[index]);
             }
 
             const ELEMENT& Get(const uint32_t index) const
@@ -3038,9 +3382,7 @@ namespace Core {
                 uint16_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
-                    while ((loaded < maxLength) && ::isspace(stream[loaded])) {
-                        loaded++;
-                    }
+                    loaded += Scanner::Whitespace(&(stream[loaded]), maxLength - loaded);
                 }
 
                 if (loaded == maxLength) {
@@ -3069,9 +3411,7 @@ namespace Core {
                 while ((offset != FIND_MARKER) && (loaded < maxLength)) {
                     if ((offset == SKIP_BEFORE) || (offset == SKIP_AFTER)) {
                         // Run till we find a character not a whitespace..
-                        while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                            loaded++;
-                        }
+                        loaded += Scanner::Whitespace(&(stream[loaded]), maxLength - loaded);
 
                         if (loaded < maxLength) {
                             switch (stream[loaded]) {
@@ -3096,7 +3436,7 @@ namespace Core {
                                     ++loaded;
                                 } else {
                                     offset = PARSE;
-                                    _data.push_back(ELEMENT());
+                                    _data.emplace_back();
                                 }
                                 break;
                             }
@@ -3186,7 +3526,7 @@ namespace Core {
                     if (offset == PARSE) {
                         if (_count > 0) {
                             _count--;
-                            _data.emplace_back(ELEMENT());
+                            _data.emplace_back();
                         } else {
                             offset = 0;
                         }
@@ -3204,7 +3544,7 @@ namespace Core {
         private:
             uint8_t _state;
             uint16_t _count;
-            std::list<ELEMENT> _data;
+            StorageType<ELEMENT> _data;
             mutable IteratorType<ELEMENT> _iterator;
         };
 
@@ -3225,7 +3565,18 @@ namespace Core {
             static constexpr uint16_t PARSE = 7;
 
             typedef std::pair<const TCHAR*, IElement*> JSONLabelValue;
-            typedef std::list<JSONLabelValue> JSONElementList;
+            // One allocation for all members (well, one per doubling), not one for each of them.
+            typedef std::vector<JSONLabelValue> JSONElementList;
+
+            // Below this number of labels, walking the list is as fast as a lookup in the index.
+            static constexpr uint16_t INDEX_THRESHOLD = 8;
+
+            struct IndexEntry {
+                uint32_t Hash;
+                const TCHAR* Label;
+                IElement* Element;
+            };
+            typedef std::vector<IndexEntry> JSONElementIndex;
 
             class Iterator {
             private:
@@ -3302,6 +3653,7 @@ namespace Core {
                 : _state(0)
                 , _count(0)
                 , _data()
+                , _index()
                 , _iterator()
                 , _fieldName(true)
             {
@@ -3312,13 +3664,7 @@ namespace Core {
         public:
             bool HasLabel(const string& label) const
             {
-                JSONElementList::const_iterator index(_data.begin());
-
-                while ((index != _data.end()) && (index->first != label)) {
-                    index++;
-                }
-
-                return (index != _data.end());
+                return (Lookup(label.c_str()) != nullptr);
             }
 
             // IElement and IMessagePack iface:
@@ -3348,11 +3694,15 @@ namespace Core {
                     index->second->Clear();
                     index++;
                 }
+
+                // A (pooled) container that was null, should not stay null.
+                _state = 0;
             }
 
             void Add(const TCHAR label[], IElement* element)
             {
                 _data.push_back(JSONLabelValue(label, element));
+                _index.clear();
             }
 
             void Remove(const TCHAR label[])
@@ -3365,6 +3715,7 @@ namespace Core {
 
                 if (index != _data.end()) {
                     _data.erase(index);
+                    _index.clear();
                 }
             }
 
@@ -3372,6 +3723,7 @@ namespace Core {
             void Reset()
             {
                 _data.clear();
+                _index.clear();
             }
 
         private:
@@ -3434,9 +3786,7 @@ namespace Core {
                 uint16_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
-                    while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                        loaded++;
-                    }
+                    loaded += Scanner::Whitespace(&(stream[loaded]), maxLength - loaded);
                 }
 
                 if (loaded == maxLength) {
@@ -3466,9 +3816,7 @@ namespace Core {
                 while ((offset != FIND_MARKER) && (loaded < maxLength)) {
                     if ((offset == SKIP_BEFORE) || (offset == SKIP_AFTER) || offset == SKIP_BEFORE_VALUE || offset == SKIP_AFTER_KEY) {
                         // Run till we find a character not a whitespace..
-                        while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                            loaded++;
-                        }
+                        loaded += Scanner::Whitespace(&(stream[loaded]), maxLength - loaded);
 
                         if (loaded < maxLength) {
                             switch (stream[loaded]) {
@@ -3705,21 +4053,67 @@ namespace Core {
                 return (loaded);
             }
 
-            IElement* Find(const char label[])
+            static uint32_t Hash(const TCHAR label[])
+            {
+                // FNV-1a, labels are short, this is all it takes to spread them.
+                uint32_t hash = 2166136261u;
+
+                while (*label != '\0') {
+                    hash = (hash ^ static_cast<uint8_t>(*label++)) * 16777619u;
+                }
+
+                return (hash);
+            }
+
+            IElement* Lookup(const TCHAR label[]) const
             {
                 IElement* result = nullptr;
 
-                JSONElementList::iterator index = _data.begin();
+                if (_data.size() < INDEX_THRESHOLD) {
+                    JSONElementList::const_iterator index = _data.begin();
 
-                while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
-                    index++;
-                }
+                    while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
+                        index++;
+                    }
 
-                if (index != _data.end()) {
-                    result = index->second;
+                    if (index != _data.end()) {
+                        result = index->second;
+                    }
+                } else {
+                    if (_index.empty() == true) {
+                        // Labels are added in the constructors, so build it once, on the first lookup.
+                        _index.reserve(_data.size());
+
+                        for (const JSONLabelValue& entry : _data) {
+                            _index.push_back({ Hash(entry.first), entry.first, entry.second });
+                        }
+
+                        // Stable, so on duplicate labels, the first one added still wins, as it does in the list.
+                        std::stable_sort(_index.begin(), _index.end(), [](const IndexEntry& lhs, const IndexEntry& rhs) { return (lhs.Hash < rhs.Hash); });
+                    }
+
+                    const uint32_t hash = Hash(label);
+
+                    JSONElementIndex::const_iterator index = std::lower_bound(_index.begin(), _index.end(), hash, [](const IndexEntry& entry, const uint32_t value) { return (entry.Hash < value); });
+
+                    while ((index != _index.end()) && (index->Hash == hash) && (strcmp(label, index->Label) != 0)) {
+                        index++;
+                    }
+
+                    if ((index != _index.end()) && (index->Hash == hash)) {
+                        result = index->Element;
+                    }
                 }
-                else if (Request(label) == true) {
-                    index = _data.end();
+
+                return (result);
+            }
+
+            IElement* Find(const char label[])
+            {
+                IElement* result = Lookup(label);
+
+                if ((result == nullptr) && (Request(label) == true)) {
+                    JSONElementList::iterator index = _data.end();
 
                     while ((result == nullptr) && (index != _data.begin())) {
                         index--;
@@ -3768,6 +4162,7 @@ namespace Core {
                 mutable IMessagePack* pack;
             } _current;
             JSONElementList _data;
+            mutable JSONElementIndex _index;
             mutable JSONElementList::const_iterator _iterator;
             mutable String _fieldName;
         };
@@ -290,6 +290,17 @@ namespace Core {
             {
                 return (Index(Designator.Value()));
             }
+            // The parameters as they were received, without copying them. Only if a JSON string was
+            // passed as parameter, its quotes need to be restored, which is done in the storage given.
+            const string& Params(string& storage) const
+            {
+                if (Parameters.IsQuoted() == false) {
+                    return (Parameters.Opaque());
+                }
+
+                storage = Parameters.Value();
+                return (storage);
+            }
             Core::JSON::String JSONRPC;
             Core::JSON::DecUInt32 Id;
             Core::JSON::String Designator;
@@ -298,6 +309,173 @@ namespace Core {
             Info Error;
         };
 
+        // An event is sent to all its observers in the same message, only the designator ("method") differs.
+        // Everything that follows the designator is rendered once, into a (reference counted) Body, that is
+        // shared by the Notifications sent to all the observers.
+        class EXTERNAL Notification : public Core::JSON::IElement, public Core::JSON::IMessagePack {
+        public:
+            class Body {
+            public:
+                Body() = delete;
+                Body(const Body&) = delete;
+                Body& operator=(const Body&) = delete;
+
+                Body(const string& parameters)
+                    : _text(parameters.empty() == true ? string(_T("}")) : (string(_T(",\"params\":")) + parameters + '}'))
+                    , _lock()
+                    , _isPacked(false)
+                    , _packed()
+                {
+                }
+                ~Body() = default;
+
+            public:
+                const string& Text() const
+                {
+                    return (_text);
+                }
+                // The parameters in MessagePack, packed once, for all channels that want them like that.
+                const std::vector<uint8_t>& Packed() const
+                {
+                    _lock.Lock();
+
+                    if (_isPacked == false) {
+                        static const size_t prefix = ::strlen(_T(",\"params\":"));
+
+                        if ((_text.length() > prefix) && (Core::JSON::MessagePack::FromText(_text.substr(prefix, _text.length() - prefix - 1), _packed) == false)) {
+                            _packed.push_back(Core::JSON::IMessagePack::NullValue);
+                        }
+                        _isPacked = true;
+                    }
+
+                    _lock.Unlock();
+
+                    return (_packed);
+                }
+
+            private:
+                const string _text;
+                mutable Core::CriticalSection _lock;
+                mutable bool _isPacked;
+                mutable std::vector<uint8_t> _packed;
+            };
+
+        public:
+            Notification(const Notification&) = delete;
+            Notification& operator=(const Notification&) = delete;
+
+            Notification()
+                : _prefix()
+                , _body()
+                , _packed()
+            {
+            }
+            ~Notification() override = default;
+
+        public:
+            void Set(const string& designator, const Core::ProxyType<Body>& body)
+            {
+                ASSERT(body.IsValid() == true);
+
+                _prefix = string(_T("{\"jsonrpc\":\"")) + Message::DefaultVersion + _T("\",\"method\":\"") + designator + '\"';
+                _body = body;
+            }
+
+            // IElement and IMessagePack iface:
+            void Clear() override
+            {
+                _prefix.clear();
+                _body.Release();
+                _packed.clear();
+            }
+            bool IsSet() const override
+            {
+                return (_body.IsValid());
+            }
+            bool IsNull() const override
+            {
+                return (false);
+            }
+            uint16_t Serialize(char stream[], const uint16_t maxLength, uint32_t& offset) const override
+            {
+                ASSERT(maxLength > 0);
+                ASSERT(_body.IsValid() == true);
+
+                const string& body(_body->Text());
+                const uint32_t length = static_cast<uint32_t>(_prefix.length() + body.length());
+                uint16_t result = 0;
+
+                // The offset is the number of characters already written, we are done when it is back to 0.
+                while ((result < maxLength) && (offset < length)) {
+                    const string& source(offset < _prefix.length() ? _prefix : body);
+                    const uint32_t position(offset < _prefix.length() ? offset : offset - static_cast<uint32_t>(_prefix.length()));
+                    const uint16_t size = static_cast<uint16_t>(std::min(static_cast<uint32_t>(maxLength - result), static_cast<uint32_t>(source.length()) - position));
+
+                    ::memcpy(&(stream[result]), &(source[position]), size);
+                    result += size;
+                    offset += size;
+                }
+
+                if (offset == length) {
+                    offset = 0;
+                }
+
+                return (result);
+            }
+            uint16_t Deserialize(const char[], const uint16_t, uint32_t&, Core::OptionalType<Core::JSON::Error>& error) override
+            {
+                // Notifications only go out..
+                ASSERT(false);
+
+                error = Core::JSON::Error{ "A notification can not be deserialized" };
+
+                return (0);
+            }
+            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, uint32_t& offset) const override
+            {
+                ASSERT(maxLength > 0);
+                ASSERT(_body.IsValid() == true);
+
+                if (offset == 0) {
+                    const std::vector<uint8_t>& parameters(_body->Packed());
+
+                    // The envelope is packed from its text, the parameters are already packed by the body.
+                    _packed.clear();
+                    Core::JSON::MessagePack::FromText(_prefix + '}', _packed);
+
+                    if (parameters.empty() == false) {
+                        // One more member in the (fix)map..
+                        _packed[0]++;
+                        Core::JSON::MessagePack::FromText(_T("\"params\""), _packed);
+                        _packed.insert(_packed.end(), parameters.begin(), parameters.end());
+                    }
+                }
+
+                const uint16_t result = static_cast<uint16_t>(std::min(static_cast<size_t>(maxLength), _packed.size() - offset));
+
+                ::memcpy(stream, &(_packed[offset]), result);
+                offset += result;
+
+                if (offset == _packed.size()) {
+                    offset = 0;
+                }
+
+                return (result);
+            }
+            uint16_t Deserialize(const uint8_t[], const uint16_t, uint32_t&) override
+            {
+                // Notifications only go out..
+                ASSERT(false);
+
+                return (0);
+            }
+
+        private:
+            string _prefix;
+            Core::ProxyType<Body> _body;
+            mutable std::vector<uint8_t> _packed;
+        };
+
         class EXTERNAL Context {
         public:
             Context& operator=(const Context& rhs) = delete;
@@ -484,7 +662,7 @@ namespace Core {
             typedef std::list<Observer> ObserverList;
             typedef std::map<string, ObserverList> ObserverMap;
 
-            typedef std::function<void(const uint32_t id, const string& designator, const string& data)> NotificationFunction;
+            typedef std::function<void(const uint32_t id, const string& designator, const Core::ProxyType<Notification::Body>& body)> NotificationFunction;
 
         public:
             class EventIterator {
@@ -745,6 +923,14 @@ namespace Core {
                 }
                 return (result);
             }
+            // The parameters are passed on straight from the message, the typed handlers (Register<INBOUND, OUTBOUND>)
+            // deserialize their parameter object from the received text, no intermediate copy is made.
+            uint32_t Invoke(const Context& context, const Message& message, string& response)
+            {
+                string storage;
+
+                return (Invoke(context, message.FullMethod(), message.Params(storage), response));
+            }
             void Subscribe(const uint32_t id, const string& eventId, const string& callsign, Core::JSONRPC::Message& response)
             {
                 _adminLock.Lock();
@@ -849,13 +1035,39 @@ namespace Core {
             }
 
         private:
+            // The objects the parameters of a method are (de)serialized from/to, are taken from a pool per method.
+            // Returning them to the pool clears them, but keeps what they allocated (members, strings), so the
+            // next call does not have to allocate it all over again.
+            template <typename JSONOBJECT>
+            class ParameterPool {
+            public:
+                ParameterPool()
+                    : _pool(std::make_shared<Core::ProxyPoolType<JSONOBJECT>>(0))
+                {
+                }
+                ParameterPool(const ParameterPool<JSONOBJECT>&) = default;
+                ParameterPool<JSONOBJECT>& operator=(const ParameterPool<JSONOBJECT>&) = default;
+                ~ParameterPool() = default;
+
+            public:
+                Core::ProxyType<JSONOBJECT> Element() const
+                {
+                    return (_pool->Element());
+                }
+
+            private:
+                std::shared_ptr<Core::ProxyPoolType<JSONOBJECT>> _pool;
+            };
+
             template <typename PARAMETER, typename GET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<1>&, const string& methodName, const GET_METHOD& getMethod, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const REALOBJECT&, PARAMETER&)> getter = getMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter](const Context&, const string&, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                ParameterPool<PARAMETER> parameterPool;
+                InvokeFunction implementation = [objectPtr, getter, parameterPool](const Context&, const string&, const string& inbound, string& outbound) -> uint32_t {
+                    Core::ProxyType<PARAMETER> parameterElement(parameterPool.Element());
+                    PARAMETER& parameter(*parameterElement);
                     uint32_t code;
                     if (inbound.empty() == false) {
                         code = Core::ERROR_UNAVAILABLE;
@@ -872,8 +1084,10 @@ namespace Core {
             {
                 std::function<uint32_t(REALOBJECT&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, setter](const Core::JSONRPC::Context&, const string&, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                ParameterPool<PARAMETER> parameterPool;
+                InvokeFunction implementation = [objectPtr, setter, parameterPool](const Core::JSONRPC::Context&, const string&, const string& inbound, string& outbound) -> uint32_t {
+                    Core::ProxyType<PARAMETER> parameterElement(parameterPool.Element());
+                    PARAMETER& parameter(*parameterElement);
                     uint32_t code;
                     if (inbound.empty() == false) {
                         parameter.FromString(inbound);
@@ -891,8 +1105,10 @@ namespace Core {
                 std::function<uint32_t(const REALOBJECT&, PARAMETER&)> getter = getMethod;
                 std::function<uint32_t(REALOBJECT&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter, setter](const Context&, const string&, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                ParameterPool<PARAMETER> parameterPool;
+                InvokeFunction implementation = [objectPtr, getter, setter, parameterPool](const Context&, const string&, const string& inbound, string& outbound) -> uint32_t {
+                    Core::ProxyType<PARAMETER> parameterElement(parameterPool.Element());
+                    PARAMETER& parameter(*parameterElement);
                     uint32_t code;
                     if (inbound.empty() == false) {
                         parameter.FromString(inbound);
@@ -910,8 +1126,10 @@ namespace Core {
             {
                 std::function<uint32_t(const REALOBJECT&, const string&, PARAMETER&)> getter = getMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter](const Context&, const string& method, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                ParameterPool<PARAMETER> parameterPool;
+                InvokeFunction implementation = [objectPtr, getter, parameterPool](const Context&, const string& method, const string& inbound, string& outbound) -> uint32_t {
+                    Core::ProxyType<PARAMETER> parameterElement(parameterPool.Element());
+                    PARAMETER& parameter(*parameterElement);
                     uint32_t code;
                     if (inbound.empty() == false) {
                         code = Core::ERROR_UNAVAILABLE;
@@ -929,8 +1147,10 @@ namespace Core {
             {
                 std::function<uint32_t(REALOBJECT&, const string&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, setter](const Core::JSONRPC::Context&, const string& method, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                ParameterPool<PARAMETER> parameterPool;
+                InvokeFunction implementation = [objectPtr, setter, parameterPool](const Core::JSONRPC::Context&, const string& method, const string& inbound, string& outbound) -> uint32_t {
+                    Core::ProxyType<PARAMETER> parameterElement(parameterPool.Element());
+                    PARAMETER& parameter(*parameterElement);
                     uint32_t code;
                     if (inbound.empty() == false) {
                         const string index = Message::Index(method);
@@ -949,8 +1169,10 @@ namespace Core {
                 std::function<uint32_t(const REALOBJECT&, const string&, PARAMETER&)> getter = getMethod;
                 std::function<uint32_t(REALOBJECT&, const string&, const PARAMETER&)> setter = setMethod;
                 ASSERT(objectPtr != nullptr);
-                InvokeFunction implementation = [objectPtr, getter, setter](const Context&, const string& method, const string& inbound, string& outbound) -> uint32_t {
-                    PARAMETER parameter;
+                ParameterPool<PARAMETER> parameterPool;
+                InvokeFunction implementation = [objectPtr, getter, setter, parameterPool](const Context&, const string& method, const string& inbound, string& outbound) -> uint32_t {
+                    Core::ProxyType<PARAMETER> parameterElement(parameterPool.Element());
+                    PARAMETER& parameter(*parameterElement);
                     uint32_t code;
                     const string index = Message::Index(method);
                     if (inbound.empty() == false) {
@@ -977,8 +1199,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const INBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context&, const string&, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
+                ParameterPool<INBOUND> inboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool](const Core::JSONRPC::Context&, const string&, const string& parameters, string&) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
                     inbound.FromString(parameters);
                     return (actualMethod(inbound));
                 };
@@ -988,8 +1212,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context&, const string&, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, outboundPool](const Core::JSONRPC::Context&, const string&, const string&, string& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     uint32_t code = actualMethod(outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1004,9 +1230,13 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const INBOUND&, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context&, const string&, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
+                ParameterPool<INBOUND> inboundPool;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool, outboundPool](const Core::JSONRPC::Context&, const string&, const string& parameters, string& result) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     inbound.FromString(parameters);
                     uint32_t code = actualMethod(inbound, outbound);
                     if (code == Core::ERROR_NONE) {
@@ -1022,8 +1252,10 @@ namespace Core {
             void InternalRegisterWithIndex(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const string& index, const INBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const string& method, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
+                ParameterPool<INBOUND> inboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool](const string& method, const string& parameters, string&) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
                     inbound.FromString(parameters);
                     return (actualMethod(Message::Index(method), inbound));
                 };
@@ -1033,8 +1265,10 @@ namespace Core {
             void InternalRegisterWithIndex(const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const string& index, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const string& method, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, outboundPool](const string& method, const string&, string& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     uint32_t code = actualMethod(Message::Index(method), outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1049,9 +1283,13 @@ namespace Core {
             void InternalRegisterWithIndex(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const string& index, const INBOUND&, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const string& method, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
+                ParameterPool<INBOUND> inboundPool;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool, outboundPool](const string& method, const string& parameters, string& result) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     inbound.FromString(parameters);
                     uint32_t code = actualMethod(Message::Index(method), inbound, outbound);
                     if (code == Core::ERROR_NONE) {
@@ -1076,8 +1314,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const INBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
-                InvokeFunction implementation = [actualMethod](const Context&, const string&, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
+                ParameterPool<INBOUND> inboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool](const Context&, const string&, const string& parameters, string&) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
                     inbound.FromString(parameters);
                     return (actualMethod(inbound));
                 };
@@ -1087,8 +1327,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(OUTBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
-                InvokeFunction implementation = [actualMethod](const Context&, const string&, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, outboundPool](const Context&, const string&, const string&, string& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     uint32_t code = actualMethod(outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1103,9 +1345,13 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const INBOUND&, OUTBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1, std::placeholders::_2);
-                InvokeFunction implementation = [actualMethod](const Context&, const string&, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
+                ParameterPool<INBOUND> inboundPool;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool, outboundPool](const Context&, const string&, const string& parameters, string& result) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     inbound.FromString(parameters);
                     uint32_t code = actualMethod(inbound, outbound);
                     if (code == Core::ERROR_NONE) {
@@ -1130,8 +1376,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const INBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string&, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
+                ParameterPool<INBOUND> inboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool](const Core::JSONRPC::Context& context, const string&, const string& parameters, string&) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
                     inbound.FromString(parameters);
                     return (actualMethod(context, inbound));
                 };
@@ -1141,8 +1389,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string&, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, outboundPool](const Core::JSONRPC::Context& context, const string&, const string&, string& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     uint32_t code = actualMethod(context, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1158,9 +1408,13 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const INBOUND&, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string&, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
+                ParameterPool<INBOUND> inboundPool;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool, outboundPool](const Core::JSONRPC::Context& context, const string&, const string& parameters, string& result) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     inbound.FromString(parameters);
                     uint32_t code = actualMethod(context, inbound, outbound);
                     if (code == Core::ERROR_NONE) {
@@ -1177,8 +1431,10 @@ namespace Core {
             void InternalRegisterWithIndex(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const string& index, const INBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string& method, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
+                ParameterPool<INBOUND> inboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool](const Core::JSONRPC::Context& context, const string& method, const string& parameters, string&) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
                     inbound.FromString(parameters);
                     return (actualMethod(context, Message::Index(method), inbound));
                 };
@@ -1188,8 +1444,10 @@ namespace Core {
             void InternalRegisterWithIndex(const ::TemplateIntToType<1>&, const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const string& index, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string& method, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, outboundPool](const Core::JSONRPC::Context& context, const string& method, const string&, string& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     uint32_t code = actualMethod(context, Message::Index(method), outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1205,9 +1463,13 @@ namespace Core {
             void InternalRegisterWithIndex(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const string& index, const INBOUND&, OUTBOUND&)> actualMethod = method;
-                InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string& method, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
+                ParameterPool<INBOUND> inboundPool;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool, outboundPool](const Core::JSONRPC::Context& context, const string& method, const string& parameters, string& result) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     inbound.FromString(parameters);
                     uint32_t code = actualMethod(context, Message::Index(method), inbound, outbound);
                     if (code == Core::ERROR_NONE) {
@@ -1233,8 +1495,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<1>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const INBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
-                InvokeFunction implementation = [actualMethod](const Context& context, const string&, const string& parameters, string&) -> uint32_t {
-                    INBOUND inbound;
+                ParameterPool<INBOUND> inboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool](const Context& context, const string&, const string& parameters, string&) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
                     inbound.FromString(parameters);
                     return (actualMethod(context, inbound));
                 };
@@ -1244,8 +1508,10 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const Core::JSONRPC::Context&, OUTBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
-                InvokeFunction implementation = [actualMethod](const Context& context, const string&, const string&, string& result) -> uint32_t {
-                    OUTBOUND outbound;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, outboundPool](const Context& context, const string&, const string&, string& result) -> uint32_t {
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     uint32_t code = actualMethod(context, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1261,9 +1527,13 @@ namespace Core {
             void InternalRegister(const ::TemplateIntToType<1>&, const ::TemplateIntToType<0>&, const ::TemplateIntToType<0>&, const string& methodName, const METHOD& method, REALOBJECT* objectPtr)
             {
                 std::function<uint32_t(const INBOUND&, OUTBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1, std::placeholders::_2);
-                InvokeFunction implementation = [actualMethod](const Context& context, const string&, const string& parameters, string& result) -> uint32_t {
-                    INBOUND inbound;
-                    OUTBOUND outbound;
+                ParameterPool<INBOUND> inboundPool;
+                ParameterPool<OUTBOUND> outboundPool;
+                InvokeFunction implementation = [actualMethod, inboundPool, outboundPool](const Context& context, const string&, const string& parameters, string& result) -> uint32_t {
+                    Core::ProxyType<INBOUND> inboundElement(inboundPool.Element());
+                    INBOUND& inbound(*inboundElement);
+                    Core::ProxyType<OUTBOUND> outboundElement(outboundPool.Element());
+                    OUTBOUND& outbound(*outboundElement);
                     inbound.FromString(parameters);
                     uint32_t code = actualMethod(context, inbound, outbound);
                     if (code == Core::ERROR_NONE) {
@@ -1328,6 +1598,9 @@ namespace Core {
                     const ObserverList& clients = index->second;
                     ObserverList::const_iterator loop = clients.begin();
 
+                    // Whatever the observers have in common is rendered once, for all of them.
+                    Core::ProxyType<Notification::Body> body(Core::ProxyType<Notification::Body>::Create(parameters));
+
                     result = Core::ERROR_NONE;
 
                     while (loop != clients.end()) {
@@ -1335,7 +1608,7 @@ namespace Core {
 
                         if (!sendifmethod || sendifmethod(designator)) {
 
-                            _notificationFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), parameters);
+                            _notificationFunction(loop->Id(), (designator.empty() == false ? designator + '.' + event : event), body);
                         }
 
                         loop++;
@@ -0,0 +1,548 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "Sync.h"
+#include "Time.h"
+
+#if defined(__LINUX__) && !defined(__APPLE__)
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+namespace WPEFramework {
+namespace Core {
+
+    // -------------------------------------------------------------------
+    // Drop-in replacement for the QueueType as used by the ThreadPool.
+    // Entries are kept in a bounded multi-producer/multi-consumer ring
+    // (see D. Vyukov, "Bounded MPMC queue"), so Post/Insert/Extract do
+    // not take a lock nor allocate. Idle consumers and producers waiting
+    // for a free slot park on a futex and are only woken if they are
+    // actually sleeping.
+    // Post() never blocks: if the ring is full the entry is added to an
+    // overflow list, just like QueueType allows Post() to exceed the high
+    // water mark. Remove() marks the entry as revoked in the ring; the
+    // consumer skips it. Lock()/Unlock() exclude a concurrent Remove(),
+    // they do not exclude each other.
+    // -------------------------------------------------------------------
+    template <typename CONTEXT>
+    class LockFreeQueueType {
+    private:
+        enum state : uint8_t {
+            FREE,
+            FILLED,
+            BUSY,
+            REVOKED
+        };
+
+        class Cell {
+        public:
+            Cell(const Cell&) = delete;
+            Cell& operator=(const Cell&) = delete;
+
+            Cell()
+                : Sequence(0)
+                , State(FREE)
+                , Data()
+            {
+            }
+            ~Cell() = default;
+
+        public:
+            std::atomic<uint32_t> Sequence;
+            std::atomic<state> State;
+            CONTEXT Data;
+        };
+
+        class Parking {
+        public:
+            Parking(const Parking&) = delete;
+            Parking& operator=(const Parking&) = delete;
+
+            Parking()
+                : _word(0)
+                , _sleepers(0)
+                , _signalled(false)
+            {
+            }
+            ~Parking() = default;
+
+        public:
+            uint32_t Ticket() const
+            {
+                return (_word.load(std::memory_order_acquire));
+            }
+            void Enter()
+            {
+                _sleepers.fetch_add(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+            void Leave()
+            {
+                _sleepers.fetch_sub(1, std::memory_order_relaxed);
+                _signalled.store(false, std::memory_order_release);
+            }
+            // Only sleeps if nobody called Wake() since the ticket was drawn.
+            bool Wait(const uint32_t ticket, const uint32_t waitTime)
+            {
+                struct timespec timeout;
+                struct timespec* limit = nullptr;
+
+                if (waitTime != Core::infinite) {
+                    timeout.tv_sec = waitTime / 1000;
+                    timeout.tv_nsec = (waitTime % 1000) * 1000 * 1000;
+                    limit = &timeout;
+                }
+
+                int result = static_cast<int>(::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_word), FUTEX_WAIT_PRIVATE, ticket, limit, nullptr, 0));
+
+                return ((result == 0) || (errno != ETIMEDOUT));
+            }
+            void Wake(const bool all)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                // One wakeup in flight is enough, whoever leaves the parking will find the rest.
+                if ((all == true) || ((_sleepers.load(std::memory_order_relaxed) > 0) && (_signalled.exchange(true, std::memory_order_acq_rel) == false))) {
+                    _word.fetch_add(1, std::memory_order_release);
+                    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_word), FUTEX_WAKE_PRIVATE, (all == true ? INT32_MAX : 1), nullptr, nullptr, 0);
+                }
+            }
+
+        private:
+            std::atomic<uint32_t> _word;
+            std::atomic<uint32_t> _sleepers;
+            std::atomic<bool> _signalled;
+        };
+
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "A futex requires a plain 32 bits word");
+
+    public:
+        LockFreeQueueType() = delete;
+        LockFreeQueueType(const LockFreeQueueType<CONTEXT>&) = delete;
+        LockFreeQueueType& operator=(const LockFreeQueueType<CONTEXT>&) = delete;
+
+        explicit LockFreeQueueType(const uint32_t highWaterMark)
+            : _mask(Slots(highWaterMark) - 1)
+            , _cells(new Cell[_mask + 1])
+            , _head(0)
+            , _tail(0)
+            , _enabled(true)
+            , _consumers()
+            , _producers()
+            , _overflowLock()
+            , _overflow()
+            , _overflowed(0)
+            , _sharers(0)
+            , _exclusive(false)
+            , _removeLock()
+        {
+            // A highwatermark of 0 is bullshit.
+            ASSERT(highWaterMark != 0);
+
+            for (uint32_t index = 0; index <= _mask; index++) {
+                _cells[index].Sequence.store(index, std::memory_order_relaxed);
+            }
+
+            TRACE_L5("Constructor LockFreeQueueType <%p>", (this));
+        }
+        ~LockFreeQueueType()
+        {
+            TRACE_L5("Destructor LockFreeQueueType <%p>", (this));
+
+            // Disable the queue and flush all entries.
+            Disable();
+
+            delete[] _cells;
+        }
+
+    public:
+        bool Remove(const CONTEXT& entry)
+        {
+            bool removed = false;
+
+            _removeLock.Lock();
+
+            // Wait till all Lock()/Unlock() sections in progress are done.
+            _exclusive.store(true, std::memory_order_seq_cst);
+
+            while (_sharers.load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+
+            if (IsEnabled() == true) {
+                const uint32_t end = _head.load(std::memory_order_acquire);
+                uint32_t position = _tail.load(std::memory_order_acquire);
+
+                while ((removed == false) && (static_cast<int32_t>(end - position) > 0)) {
+                    Cell& cell(_cells[position & _mask]);
+                    state expected = FILLED;
+
+                    if ((cell.Sequence.load(std::memory_order_acquire) == (position + 1)) && (cell.State.compare_exchange_strong(expected, BUSY, std::memory_order_acquire) == true)) {
+                        if (cell.Data == entry) {
+                            cell.Data = CONTEXT();
+                            removed = true;
+                        }
+                        cell.State.store(removed ? REVOKED : FILLED, std::memory_order_release);
+                    }
+
+                    position++;
+                }
+
+                if ((removed == false) && (_overflowed.load(std::memory_order_acquire) > 0)) {
+                    _overflowLock.Lock();
+
+                    typename std::list<CONTEXT>::iterator index = std::find(_overflow.begin(), _overflow.end(), entry);
+
+                    if (index != _overflow.end()) {
+                        _overflow.erase(index);
+                        _overflowed.fetch_sub(1, std::memory_order_release);
+                        removed = true;
+                    }
+
+                    _overflowLock.Unlock();
+                }
+            }
+
+            _exclusive.store(false, std::memory_order_release);
+
+            _removeLock.Unlock();
+
+            return (removed);
+        }
+
+        bool Post(const CONTEXT& entry)
+        {
+            bool result = false;
+
+            if (IsEnabled() == true) {
+                if ((_overflowed.load(std::memory_order_acquire) != 0) || (Push(entry) == false)) {
+                    _overflowLock.Lock();
+                    _overflow.push_back(entry);
+                    _overflowed.fetch_add(1, std::memory_order_release);
+                    _overflowLock.Unlock();
+                }
+
+                _consumers.Wake(false);
+
+                result = true;
+            }
+
+            return (result);
+        }
+
+        bool Insert(const CONTEXT& entry, uint32_t waitTime)
+        {
+            bool posted = false;
+            bool triggered = true;
+
+            while ((posted == false) && (triggered == true) && (IsEnabled() == true)) {
+                if ((_overflowed.load(std::memory_order_acquire) == 0) && (Push(entry) == true)) {
+                    _consumers.Wake(false);
+                    posted = true;
+                } else if (waitTime == 0) {
+                    triggered = false;
+                } else {
+                    uint32_t ticket = _producers.Ticket();
+
+                    _producers.Enter();
+
+                    // Slot might have come available before we announced ourselves.
+                    if ((IsFull() == true) && (IsEnabled() == true)) {
+                        uint64_t start = (waitTime != Core::infinite ? Time::Now().Ticks() : 0);
+
+                        triggered = _producers.Wait(ticket, waitTime);
+
+                        if ((triggered == true) && (waitTime != Core::infinite)) {
+                            uint32_t passed = static_cast<uint32_t>((Time::Now().Ticks() - start) / Time::TicksPerMillisecond);
+                            waitTime = (passed < waitTime ? waitTime - passed : 0);
+                        }
+                    } else {
+                        // A consumer claimed a slot but did not release it yet, give it some room.
+                        std::this_thread::yield();
+                    }
+
+                    _producers.Leave();
+                }
+            }
+
+            return (posted);
+        }
+
+        bool Extract(CONTEXT& result, uint32_t waitTime)
+        {
+            bool received = false;
+            bool triggered = true;
+
+            while ((received == false) && (triggered == true) && (IsEnabled() == true)) {
+                if (Pop(result) == true) {
+                    // Let parked producers in batches, not for every single slot that comes available.
+                    if (Length() <= ((_mask + 1) / 2)) {
+                        _producers.Wake(false);
+                    }
+                    received = true;
+                } else if (waitTime == 0) {
+                    triggered = false;
+                } else {
+                    uint32_t ticket = _consumers.Ticket();
+
+                    _consumers.Enter();
+
+                    // Entry might have come in before we announced ourselves.
+                    if ((IsEmpty() == true) && (IsEnabled() == true)) {
+                        uint64_t start = (waitTime != Core::infinite ? Time::Now().Ticks() : 0);
+
+                        triggered = _consumers.Wait(ticket, waitTime);
+
+                        if ((triggered == true) && (waitTime != Core::infinite)) {
+                            uint32_t passed = static_cast<uint32_t>((Time::Now().Ticks() - start) / Time::TicksPerMillisecond);
+                            waitTime = (passed < waitTime ? waitTime - passed : 0);
+                        }
+                    } else {
+                        // A producer claimed a slot but did not publish it yet, give it some room.
+                        std::this_thread::yield();
+                    }
+
+                    _consumers.Leave();
+                }
+            }
+
+            return (received);
+        }
+
+        void Enable()
+        {
+            _enabled.store(true, std::memory_order_release);
+        }
+
+        void Disable()
+        {
+            if (_enabled.exchange(false, std::memory_order_acq_rel) == true) {
+                // Everybody waiting has to see this change
+                _consumers.Wake(true);
+                _producers.Wake(true);
+            }
+        }
+
+        void Flush()
+        {
+            // Clear is only possible in a "DISABLED" state !!
+            ASSERT(IsEnabled() == false);
+
+            CONTEXT entry;
+
+            while (Pop(entry) == true) {
+                entry = CONTEXT();
+            }
+        }
+
+        inline bool IsEnabled() const
+        {
+            return (_enabled.load(std::memory_order_acquire));
+        }
+        inline bool IsEmpty() const
+        {
+            return ((_head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire)) && (_overflowed.load(std::memory_order_acquire) == 0));
+        }
+        inline bool IsFull() const
+        {
+            return (((_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire)) > _mask) || (_overflowed.load(std::memory_order_acquire) != 0));
+        }
+        // Revoked entries are counted till a consumer passes them.
+        inline uint32_t Length() const
+        {
+            return ((_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire)) + _overflowed.load(std::memory_order_acquire));
+        }
+        inline uint32_t Slots() const
+        {
+            return (_mask + 1);
+        }
+        bool HasEntry(const CONTEXT& element) const
+        {
+            bool found = false;
+            const uint32_t end = _head.load(std::memory_order_acquire);
+            uint32_t position = _tail.load(std::memory_order_acquire);
+
+            while ((found == false) && (static_cast<int32_t>(end - position) > 0)) {
+                Cell& cell(_cells[position & _mask]);
+                state expected = FILLED;
+
+                if ((cell.Sequence.load(std::memory_order_acquire) == (position + 1)) && (cell.State.compare_exchange_strong(expected, BUSY, std::memory_order_acquire) == true)) {
+                    found = (cell.Data == element);
+                    cell.State.store(FILLED, std::memory_order_release);
+                }
+
+                position++;
+            }
+
+            if ((found == false) && (_overflowed.load(std::memory_order_acquire) > 0)) {
+                _overflowLock.Lock();
+                found = (std::find(_overflow.cbegin(), _overflow.cend(), element) != _overflow.cend());
+                _overflowLock.Unlock();
+            }
+
+            return (found);
+        }
+        void Lock()
+        {
+            _sharers.fetch_add(1, std::memory_order_seq_cst);
+
+            while (_exclusive.load(std::memory_order_seq_cst) == true) {
+                _sharers.fetch_sub(1, std::memory_order_seq_cst);
+
+                while (_exclusive.load(std::memory_order_acquire) == true) {
+                    std::this_thread::yield();
+                }
+
+                _sharers.fetch_add(1, std::memory_order_seq_cst);
+            }
+        }
+        void Unlock()
+        {
+            _sharers.fetch_sub(1, std::memory_order_release);
+        }
+
+    private:
+        static uint32_t Slots(const uint32_t highWaterMark)
+        {
+            uint32_t slots = 2;
+
+            while ((slots < highWaterMark) && (slots < 0x80000000)) {
+                slots <<= 1;
+            }
+
+            return (slots);
+        }
+        bool Push(const CONTEXT& entry)
+        {
+            Cell* cell = nullptr;
+            uint32_t position = _head.load(std::memory_order_relaxed);
+
+            while (cell == nullptr) {
+                Cell& candidate(_cells[position & _mask]);
+                int32_t delta = static_cast<int32_t>(candidate.Sequence.load(std::memory_order_acquire) - position);
+
+                if (delta == 0) {
+                    if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                        cell = &candidate;
+                    }
+                } else if (delta < 0) {
+                    // The ring is full.
+                    break;
+                } else {
+                    position = _head.load(std::memory_order_relaxed);
+                }
+            }
+
+            if (cell != nullptr) {
+                cell->Data = entry;
+                cell->State.store(FILLED, std::memory_order_release);
+                cell->Sequence.store(position + 1, std::memory_order_release);
+            }
+
+            return (cell != nullptr);
+        }
+        bool Pop(CONTEXT& result)
+        {
+            bool received = false;
+            bool empty = false;
+
+            while ((received == false) && (empty == false)) {
+                Cell* cell = nullptr;
+                uint32_t position = _tail.load(std::memory_order_relaxed);
+
+                while (cell == nullptr) {
+                    Cell& candidate(_cells[position & _mask]);
+                    int32_t delta = static_cast<int32_t>(candidate.Sequence.load(std::memory_order_acquire) - (position + 1));
+
+                    if (delta == 0) {
+                        if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                            cell = &candidate;
+                        }
+                    } else if (delta < 0) {
+                        // Nothing (yet) in the ring.
+                        break;
+                    } else {
+                        position = _tail.load(std::memory_order_relaxed);
+                    }
+                }
+
+                if (cell != nullptr) {
+                    state expected = FILLED;
+
+                    // A Remove() or HasEntry() might be inspecting this cell, that is over in a jiffy.
+                    while (cell->State.compare_exchange_weak(expected, BUSY, std::memory_order_acquire) == false) {
+                        if (expected == REVOKED) {
+                            break;
+                        }
+                        expected = FILLED;
+                        std::this_thread::yield();
+                    }
+
+                    if (expected != REVOKED) {
+                        result = std::move(cell->Data);
+                        cell->Data = CONTEXT();
+                        received = true;
+                    }
+
+                    cell->State.store(FREE, std::memory_order_relaxed);
+                    cell->Sequence.store(position + _mask + 1, std::memory_order_release);
+                } else if (_overflowed.load(std::memory_order_acquire) > 0) {
+                    _overflowLock.Lock();
+
+                    if (_overflow.empty() == false) {
+                        result = _overflow.front();
+                        _overflow.pop_front();
+                        _overflowed.fetch_sub(1, std::memory_order_release);
+                        received = true;
+                    }
+
+                    _overflowLock.Unlock();
+
+                    empty = !received;
+                } else {
+                    empty = true;
+                }
+            }
+
+            return (received);
+        }
+
+    private:
+        const uint32_t _mask;
+        Cell* _cells;
+        std::atomic<uint32_t> _head;
+        std::atomic<uint32_t> _tail;
+        std::atomic<bool> _enabled;
+        Parking _consumers;
+        Parking _producers;
+        mutable CriticalSection _overflowLock;
+        std::list<CONTEXT> _overflow;
+        std::atomic<uint32_t> _overflowed;
+        std::atomic<uint32_t> _sharers;
+        std::atomic<bool> _exclusive;
+        CriticalSection _removeLock;
+    };
+}
+} // namespace Core
+
+#endif // __LINUX__ && !__APPLE__
@@ -390,6 +390,8 @@ int clock_gettime(int, struct timespec*);
 #include <linux/input.h>
 #include <linux/types.h>
 #include <linux/uinput.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/signalfd.h>
 #endif
 
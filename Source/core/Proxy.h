@@ -23,6 +23,7 @@
  // ---- Include system wide include files ----
 #include <memory>
 #include <atomic>
+#include <vector>
 
 // ---- Include local include files ----
 #include "Portability.h"
@@ -1396,7 +1397,9 @@ POP_WARNING()
         class ProxyPoolType {
         private:
             using ContainerElement = ProxyContainerType< ProxyPoolType<PROXYELEMENT>, PROXYELEMENT, PROXYELEMENT>;
-            using ContainerList = std::list< Core::ProxyType<ContainerElement> >;
+            // Used as a stack: handing out and taking back an element does not allocate, once it has grown
+            // to the number of elements in use, and the element handed out is the one used most recently.
+            using ContainerList = std::vector< Core::ProxyType<ContainerElement> >;
 
         public:
             ProxyPoolType(const ProxyPoolType<PROXYELEMENT>&) = delete;
@@ -1407,6 +1410,8 @@ POP_WARNING()
                 : _createdElements(initialQueueSize)
                 , _lock()
             {
+                _queue.reserve(initialQueueSize);
+
                 for (uint32_t index = 0; index < initialQueueSize; index++) {
                     Core::ProxyType<ContainerElement> newElement;
 
@@ -1424,9 +1429,9 @@ POP_WARNING()
 
                         _lock.Lock();
 
-                        Core::ProxyType<ContainerElement> expendable(std::move(_queue.front()));
+                        Core::ProxyType<ContainerElement> expendable(std::move(_queue.back()));
                         expendable->Unlink();
-                        _queue.pop_front();
+                        _queue.pop_back();
                         _createdElements--;
 
                         _lock.Unlock();
@@ -1467,9 +1472,9 @@ POP_WARNING()
                     result = Core::ProxyType<PROXYELEMENT>(element);
                 }
                 else {
-                    element = _queue.front();
+                    element = std::move(_queue.back());
                     result = Core::ProxyType<PROXYELEMENT>(element);
-                    _queue.pop_front();
+                    _queue.pop_back();
 
                     _lock.Unlock();
                 }
@@ -37,5 +37,118 @@ namespace Core {
         return (_instance);
 #endif
     }
+
+    ResourceMonitor::ResourceMonitor()
+        : _monitors()
+    {
+        _monitors.push_back(new ResourceMonitorBase());
+    }
+
+    ResourceMonitor::~ResourceMonitor()
+    {
+        for (ResourceMonitorBase* monitor : _monitors) {
+            delete monitor;
+        }
+        _monitors.clear();
+    }
+
+    bool ResourceMonitor::Monitors(const uint8_t count)
+    {
+        // Resources are found back by hashing, so they would get lost when the
+        // number of monitors changes while they are registered.
+        bool changed = ((count > 0) && (Count() == 0));
+
+        if (changed == true) {
+            while (_monitors.size() > count) {
+                delete _monitors.back();
+                _monitors.pop_back();
+            }
+            while (_monitors.size() < count) {
+                _monitors.push_back(new ResourceMonitorBase());
+            }
+        }
+        else {
+            TRACE_L1("Could not change the number of resource monitors to %d, resources are already registered.", count);
+        }
+
+        return (changed);
+    }
+
+    uint32_t ResourceMonitor::Runs() const
+    {
+        uint32_t runs = 0;
+
+        for (const ResourceMonitorBase* monitor : _monitors) {
+            runs += monitor->Runs();
+        }
+
+        return (runs);
+    }
+
+    uint32_t ResourceMonitor::WakeupRequests() const
+    {
+        uint32_t requests = 0;
+
+        for (const ResourceMonitorBase* monitor : _monitors) {
+            requests += monitor->WakeupRequests();
+        }
+
+        return (requests);
+    }
+
+    uint32_t ResourceMonitor::Wakeups() const
+    {
+        uint32_t wakeups = 0;
+
+        for (const ResourceMonitorBase* monitor : _monitors) {
+            wakeups += monitor->Wakeups();
+        }
+
+        return (wakeups);
+    }
+
+    uint32_t ResourceMonitor::IOEvents() const
+    {
+        uint32_t events = 0;
+
+        for (const ResourceMonitorBase* monitor : _monitors) {
+            events += monitor->IOEvents();
+        }
+
+        return (events);
+    }
+
+    uint32_t ResourceMonitor::Count() const
+    {
+        uint32_t count = 0;
+
+        for (const ResourceMonitorBase* monitor : _monitors) {
+            count += monitor->Count();
+        }
+
+        return (count);
+    }
+
+    bool ResourceMonitor::Info(const uint32_t position, Metadata& info) const
+    {
+        uint32_t offset = position;
+        std::vector<ResourceMonitorBase*>::const_iterator index(_monitors.cbegin());
+
+        while ((index != _monitors.cend()) && (offset >= (*index)->Count())) {
+            offset -= (*index)->Count();
+            index++;
+        }
+
+        return ((index != _monitors.cend()) && ((*index)->Info(offset, info) == true));
+    }
+
+    void ResourceMonitor::Break()
+    {
+        for (ResourceMonitorBase* monitor : _monitors) {
+            if (monitor->Count() > 0) {
+                monitor->Break();
+            }
+        }
+    }
 }
 } // namespace WPEFramework::Core
@@ -26,6 +26,7 @@
 #include "Thread.h"
 #include "Trace.h"
 #include "Timer.h"
+#include <vector>
 
 namespace WPEFramework {
 
@@ -48,6 +49,29 @@ namespace Core {
 
         typedef ResourceMonitorType<RESOURCE, WATCHDOG> Parent;
 
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+        // The resources express their interest in poll(2) flags. On Linux the epoll(7) flags
+        // share these values, so they can be handed over as is.
+        static_assert((POLLIN == EPOLLIN) && (POLLPRI == EPOLLPRI) && (POLLOUT == EPOLLOUT) && (POLLERR == EPOLLERR) && (POLLHUP == EPOLLHUP),
+            "poll and epoll event flags are expected to be equal");
+
+        static constexpr uint8_t EventAllocation = 64;
+
+#ifdef __CORE_RESOURCE_MONITOR_EDGE_TRIGGERED__
+        static constexpr uint32_t TriggerMode = EPOLLET;
+#else
+        static constexpr uint32_t TriggerMode = 0;
+#endif
+
+        struct Registration {
+            RESOURCE* resource;
+            uint16_t monitor;
+            uint16_t events;
+        };
+
+        typedef std::unordered_map<IResource::handle, Registration> Registrations;
+#endif
+
         ResourceMonitorType(const ResourceMonitorType&) = delete;
         ResourceMonitorType& operator=(const ResourceMonitorType&) = delete;
 
@@ -99,12 +123,32 @@ namespace Core {
         ResourceMonitorType()
             : _monitor(nullptr)
             , _adminLock()
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+            , _registrations()
+            , _evaluate()
+            , _ready()
+            , _breakIssued(false)
+            , _pendingLock()
+            , _pending()
+            , _collected()
+#else
             , _resourceList()
+#endif
             , _monitorRuns(0)
+            , _parkingLock()
+            , _parked()
+            , _handovers()
+            , _wakeupPending(false)
+            , _wakeupRequests(0)
+            , _wakeups(0)
+            , _ioEvents(0)
             , _name(_T("Monitor::") + ClassNameOnly(typeid(RESOURCE).name()).Text())
             , _watchDog(1024 * 512, _name.c_str())
 #ifdef __WINDOWS__
             , _action(WSACreateEvent())
+#elif defined(__CORE_RESOURCE_MONITOR_EPOLL__)
+            , _signalDescriptor(-1)
+            , _epollDescriptor(-1)
 #else
             , _descriptorArrayLength(FileDescriptorAllocation)
             , _descriptorArray(static_cast<struct pollfd*>(::malloc(sizeof(::pollfd) * (_descriptorArrayLength + 1))))
@@ -117,7 +161,7 @@ namespace Core {
         {
 
             // All resources should be gone !!!
-            ASSERT(_resourceList.size() == 0);
+            ASSERT(Count() == 0);
 
             if (_monitor != nullptr) {
 
@@ -127,7 +171,11 @@ namespace Core {
 
                 _adminLock.Lock();
 
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+                _registrations.clear();
+#else
                 _resourceList.clear();
+#endif
 
                 _adminLock.Unlock();
 
@@ -135,7 +183,13 @@ namespace Core {
             }
 
 #ifdef __LINUX__
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+            if (_epollDescriptor != -1) {
+                ::close(_epollDescriptor);
+            }
+#else
             ::free(_descriptorArray);
+#endif
             if (_signalDescriptor != -1) {
                 ::close(_signalDescriptor);
             }
@@ -154,14 +208,147 @@ namespace Core {
         {
             return (_monitorRuns);
         }
+        // Number of times the monitor thread was asked to wake up, the number of times it
+        // actually had to be woken up and the number of I/O events it handled.
+        uint32_t WakeupRequests() const
+        {
+            return (_wakeupRequests);
+        }
+        uint32_t Wakeups() const
+        {
+            return (_wakeups);
+        }
+        uint32_t IOEvents() const
+        {
+            return (_ioEvents);
+        }
         ::ThreadId Id() const
         {
             return (_monitor != nullptr ? _monitor->Id() : 0);
         }
         uint32_t Count() const 
         {
-            return (static_cast<uint32_t>(_resourceList.size()));
+            _parkingLock.Lock();
+            uint32_t parked = static_cast<uint32_t>(_parked.size());
+            _parkingLock.Unlock();
+
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+            return (static_cast<uint32_t>(_registrations.size()) + parked);
+#else
+            return (static_cast<uint32_t>(_resourceList.size()) + parked);
+#endif
+        }
+        // Register a resource from within a callback on the thread of another monitor (the caller),
+        // e.g. a connection that got accepted. The resource is probably still being set up, so it
+        // is parked here and handed over as soon as the caller finished its current run.
+        void Register(RESOURCE& resource, Parent& caller)
+        {
+            ASSERT(caller.Id() == Thread::ThreadId());
+
+            _parkingLock.Lock();
+            _parked.push_back(&resource);
+            _parkingLock.Unlock();
+
+            caller._handovers.emplace_back(this, &resource);
         }
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+        bool Info (const uint32_t position, Metadata& info) const
+        {
+            uint32_t count = position;
+
+            _adminLock.Lock();
+
+            typename Registrations::const_iterator index(_registrations.cbegin());
+            while ( (count != 0) && (index != _registrations.cend()) ) { count--; index++; }
+
+            bool found = (index != _registrations.cend());
+
+            if (found == true) {
+                info.descriptor = index->first;
+                info.classname  = typeid(*(index->second.resource)).name();
+                info.monitor    = index->second.monitor;
+                info.events     = index->second.events;
+
+                char procfn[64];
+                sprintf(procfn, "/proc/self/fd/%d", info.descriptor);
+
+                ssize_t len = readlink(procfn, info.filename, sizeof(info.filename) - 1);
+                info.filename[(len > 0 ? len : 0)] = '\0';
+            }
+
+            _adminLock.Unlock();
+
+            return (found);
+        }
+        void Register(RESOURCE& resource)
+        {
+            const IResource::handle descriptor = resource.Descriptor();
+
+            _adminLock.Lock();
+
+            typename Registrations::iterator index(_registrations.find(descriptor));
+
+            // Make sure this entry is only registered once !!!
+            if (index == _registrations.end()) {
+                _registrations.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(descriptor),
+                    std::forward_as_tuple(Registration { &resource, 0, 0 }));
+                _evaluate.push_back(descriptor);
+            } else if (index->second.resource != &resource) {
+                // The descriptor got closed and reused before its previous owner unregistered,
+                // the kernel already dropped the old one from the epoll set, take it over.
+                index->second = Registration { &resource, 0, 0 };
+                _evaluate.push_back(descriptor);
+            }
+
+            if (_registrations.size() == 1) {
+                if (_monitor == nullptr) {
+                    _monitor = new MonitorWorker(*this);
+
+                    // Wait till we are at least initialized
+                    _monitor->Wait(Thread::BLOCKED | Thread::STOPPED);
+                }
+
+                _monitor->Run();
+            }
+
+            // The new resource has to be evaluated by the worker, no need to revisit all others.
+            Wakeup();
+
+            _adminLock.Unlock();
+        }
+        void Unregister(RESOURCE& resource)
+        {
+            _adminLock.Lock();
+
+            Unpark(resource);
+
+            // Most resources are unregistered while their descriptor is still valid, if not, look it up.
+            typename Registrations::iterator index(_registrations.find(resource.Descriptor()));
+
+            if ((index == _registrations.end()) || (index->second.resource != &resource)) {
+                index = _registrations.begin();
+                while ((index != _registrations.end()) && (index->second.resource != &resource)) {
+                    index++;
+                }
+            }
+
+            if (index != _registrations.end()) {
+                if (index->second.monitor != 0) {
+                    // If the descriptor is already closed, the kernel removed it from the set.
+                    ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, index->first, nullptr);
+                }
+                _registrations.erase(index);
+            }
+
+            // The resource might be gone before the worker gets to its pending break.
+            _pendingLock.Lock();
+            _pending.erase(std::remove(_pending.begin(), _pending.end(), &resource), _pending.end());
+            _pendingLock.Unlock();
+
+            _adminLock.Unlock();
+        }
+#else
         bool Info (const uint32_t position, Metadata& info) const
         {
             uint32_t count = position;
@@ -217,7 +404,7 @@ namespace Core {
 
                 _monitor->Run();
             } else {
-                Break();
+                Wakeup();
             }
 
             _adminLock.Unlock();
@@ -226,36 +413,109 @@ namespace Core {
         {
             _adminLock.Lock();
 
+            Unpark(resource);
+
             // Make sure this entry does not exist, only register resources once !!!
             typename std::list<RESOURCE*>::iterator index(std::find(_resourceList.begin(), _resourceList.end(), &resource));
 
             if (index != _resourceList.end()) {
                 *index = nullptr;
-                Break();
+                Wakeup();
             }
 
             _adminLock.Unlock();
         }
+#endif
         inline void Break()
         {
 
             ASSERT(_monitor != nullptr);
 
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+            // Whomever breaks does not tell which resource changed, so all have to be evaluated.
+            _breakIssued = true;
+#endif
+            Wakeup();
+        };
+        // Only the given resource changed its state, have just that one evaluated and handled.
+        inline void Break(const RESOURCE& resource)
+        {
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+            // Called with the resource its own lock taken, so only a leaf lock can be used here.
+            _pendingLock.Lock();
+            if (std::find(_pending.begin(), _pending.end(), &resource) == _pending.end()) {
+                _pending.push_back(&resource);
+            }
+            _pendingLock.Unlock();
+#else
+            DEBUG_VARIABLE(resource);
+#endif
+            Wakeup();
+        }
+
+    private:
+        bool Unpark(const RESOURCE& resource)
+        {
+            _parkingLock.Lock();
+
+            typename std::vector<RESOURCE*>::iterator index(std::find(_parked.begin(), _parked.end(), &resource));
+            bool found = (index != _parked.end());
+
+            if (found == true) {
+                _parked.erase(index);
+            }
+
+            _parkingLock.Unlock();
+
+            return (found);
+        }
+        // Called by the monitor that parked the resource here, without holding its own lock.
+        void Adopt(RESOURCE& resource)
+        {
+            _adminLock.Lock();
+
+            // If it was unregistered in the mean time, it might not even exist anymore.
+            if (Unpark(resource) == true) {
+                Register(resource);
+            }
+
+            _adminLock.Unlock();
+        }
+        void Handover()
+        {
+            for (const std::pair<Parent*, RESOURCE*>& entry : _handovers) {
+                entry.first->Adopt(*(entry.second));
+            }
+            _handovers.clear();
+        }
+        // Wake up the monitor thread, unless a wakeup is already on its way or the monitor thread
+        // itself is the caller, it picks up all changes before it waits again. The worker clears
+        // the pending flag after it consumed the wakeup, but before it handles the resources, so
+        // no change made before a call is lost and no call after it goes unsignalled.
+        void Wakeup()
+        {
+            _wakeupRequests++;
+
+            if ((_monitor != nullptr) && (_monitor->Id() != Thread::ThreadId()) && (_wakeupPending.exchange(true) == false)) {
+                _wakeups++;
+
 #ifdef __APPLE__
-            int data = 0;
-            ::sendto(_signalDescriptor
-                    & data,
-                sizeof(data), 0,
-                _signalNode,
-                _signalNode.Size());
+                int data = 0;
+                ::sendto(_signalDescriptor
+                        & data,
+                    sizeof(data), 0,
+                    _signalNode,
+                    _signalNode.Size());
 #elif defined(__LINUX__)
-            _monitor->Signal(SIGUSR2);
+                const uint64_t value = 1;
+                ssize_t VARIABLE_IS_NOT_USED bytes = ::write(_signalDescriptor, &value, sizeof(value));
+                ASSERT(bytes == sizeof(value));
 #elif defined(__WINDOWS__)
-            ::WSASetEvent(_action);
+                ::WSASetEvent(_action);
 #endif
-        };
+            }
+        }
 
-    private:
         IS_MEMBER_AVAILABLE(Arm, hasArm);
 
         template <typename TYPE=WATCHDOG>
@@ -309,34 +569,112 @@ namespace Core {
 
 #else
 
-            sigset_t sigset;
+            // All wakeups that happen before the worker gets to it add up in a single event.
+            _signalDescriptor = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
 
-            /* Create a sigset of all the signals that we're interested in */
-            int VARIABLE_IS_NOT_USED err = sigemptyset(&sigset);
-            ASSERT(err == 0);
-            err = sigaddset(&sigset, SIGUSR2);
-            ASSERT(err == 0);
+#endif
 
-            /* We must block the signals in order for signalfd to receive them */
-            err = pthread_sigmask(SIG_BLOCK, &sigset, nullptr);
-            assert(err == 0);
+            ASSERT(_signalDescriptor != -1);
 
-            /* Create the signalfd */
-            _signalDescriptor = signalfd(-1, &sigset, SFD_CLOEXEC);
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+            _epollDescriptor = ::epoll_create1(EPOLL_CLOEXEC);
 
-#endif
+            ASSERT(_epollDescriptor != -1);
 
-            ASSERT(_signalDescriptor != -1);
+            if ((_epollDescriptor != -1) && (_signalDescriptor != -1)) {
+                struct ::epoll_event signal;
+                signal.events = EPOLLIN;
+                signal.data.fd = _signalDescriptor;
 
+                if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, _signalDescriptor, &signal) != 0) {
+                    TRACE_L1("Error on adding the signal descriptor to the epoll set. Error %d", errno);
+                    ::close(_epollDescriptor);
+                    _epollDescriptor = -1;
+                }
+            }
+
+            return ((_signalDescriptor != -1) && (_epollDescriptor != -1) ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+#else
             _descriptorArray[0].fd = _signalDescriptor;
             _descriptorArray[0].events = POLLIN;
             _descriptorArray[0].revents = 0;
 
             return (_signalDescriptor != -1 ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+#endif
         }
 #endif
 
-#ifdef __LINUX__
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+        uint32_t Worker()
+        {
+            uint32_t delay = 0;
+
+            _monitorRuns++;
+
+            _adminLock.Lock();
+
+            // Pick up the resources that got a Break since the last run.
+            Collect();
+
+            // Only the resources that were triggered, handled or newly registered might
+            // have a different interest, bring the epoll set up to date for those.
+            Evaluate();
+
+            if (_registrations.size() > 0) {
+                // If there are resources waiting to be handled, just pick up what is available.
+                const int timeout = (_ready.empty() == true ? -1 : 0);
+
+                _adminLock.Unlock();
+
+                int result = ::epoll_wait(_epollDescriptor, _eventArray, EventAllocation, timeout);
+
+                _adminLock.Lock();
+
+                if (result == -1) {
+                    TRACE_L1("epoll_wait failed with error <%d>", errno);
+                } else {
+                    for (int index = 0; index < result; index++) {
+                        const IResource::handle descriptor = _eventArray[index].data.fd;
+
+                        if (descriptor == _signalDescriptor) {
+                            uint64_t value;
+
+                            ssize_t VARIABLE_IS_NOT_USED bytes = ::read(_signalDescriptor, &value, sizeof(value));
+
+                            // Whatever was requested before this point is picked up in the next run.
+                            _wakeupPending = false;
+                        } else {
+                            typename Registrations::iterator entry(_registrations.find(descriptor));
+
+                            _ioEvents++;
+
+                            if (entry != _registrations.end()) {
+                                entry->second.events = static_cast<uint16_t>(_eventArray[index].events);
+                                _ready.push_back(descriptor);
+                            } else {
+                                // Unregistered without being closed in the mean time, stop watching it.
+                                ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+                            }
+                        }
+                    }
+                }
+
+                Dispatch();
+            } else {
+                _monitor->Block();
+                delay = Core::infinite;
+            }
+
+            _adminLock.Unlock();
+
+            // Resources registered on other monitors during this run are set up by now.
+            Handover();
+
+            return (delay);
+        }
+#endif
+
+#if defined(__LINUX__) && !defined(__CORE_RESOURCE_MONITOR_EPOLL__)
         uint32_t Worker()
         {
             uint32_t delay = 0;
@@ -394,11 +732,13 @@ namespace Core {
 #ifdef __APPLE__
                     int info;
 #else
-                    /* We have a valid signal, read the info from the fd */
-                    struct signalfd_siginfo info;
+                    uint64_t info;
 #endif
                     uint32_t VARIABLE_IS_NOT_USED bytes = read(_signalDescriptor, &info, sizeof(info));
                     ASSERT(bytes == sizeof(info) || bytes == 0);
+
+                    // All resources are handled below, whatever was requested up till here is covered.
+                    _wakeupPending = false;
                 }
 
                 // We are only interested in the filedescriptors that have a corresponding client.
@@ -420,6 +760,10 @@ namespace Core {
 
                         uint16_t flagsSet = _descriptorArray[fd_index].revents;
 
+                        if (flagsSet != 0) {
+                            _ioEvents++;
+                        }
+
                         Arm();
 
                         // Event if the flagsSet == 0, call handle, maybe a break was issued by this RESOURCE..
@@ -438,6 +782,9 @@ namespace Core {
 
             _adminLock.Unlock();
 
+            // Resources registered on other monitors during this run are set up by now.
+            Handover();
+
             return (delay);
         }
 #endif
@@ -484,6 +831,9 @@ namespace Core {
 
                 ::WSAResetEvent(_action);
 
+                // All resources are handled below, whatever was requested up till here is covered.
+                _wakeupPending = false;
+
                 while (index != _resourceList.end()) {
                     RESOURCE* entry = (*index);
 
@@ -496,6 +846,10 @@ namespace Core {
 
                         uint16_t flagsSet = static_cast<uint16_t>(networkEvents.lNetworkEvents);
 
+                        if (flagsSet != 0) {
+                            _ioEvents++;
+                        }
+
                         Arm();
 
                         // Event if the flagsSet == 0, call handle, maybe a break was issued by this RESOURCE..
@@ -512,23 +866,181 @@ namespace Core {
 
             _adminLock.Unlock();
 
+            // Resources registered on other monitors during this run are set up by now.
+            Handover();
+
             return (delay);
         }
 #endif
 
+    private:
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+        void Collect()
+        {
+            if (_breakIssued.exchange(false) == true) {
+                // Someone changed the state of a resource, without telling which one. Like
+                // the poll variant, evaluate all of them and hand all of them a Handle().
+                _pendingLock.Lock();
+                _pending.clear();
+                _pendingLock.Unlock();
+
+                for (const std::pair<const IResource::handle, Registration>& entry : _registrations) {
+                    _ready.push_back(entry.first);
+                }
+                _evaluate.insert(_evaluate.end(), _ready.begin(), _ready.end());
+            } else {
+                _pendingLock.Lock();
+                _collected.swap(_pending);
+                _pendingLock.Unlock();
+
+                // Unregister drops the pending breaks, so these resources are still alive.
+                for (const RESOURCE* resource : _collected) {
+                    typename Registrations::iterator entry(_registrations.find(resource->Descriptor()));
+
+                    if ((entry == _registrations.end()) || (entry->second.resource != resource)) {
+                        // Its descriptor changed since it was evaluated, look it up.
+                        entry = _registrations.begin();
+                        while ((entry != _registrations.end()) && (entry->second.resource != resource)) {
+                            entry++;
+                        }
+                    }
+
+                    if (entry != _registrations.end()) {
+                        _evaluate.push_back(entry->first);
+                        _ready.push_back(entry->first);
+                    }
+                }
+
+                _collected.clear();
+            }
+        }
+        void Evaluate()
+        {
+            // Evaluating a resource might (un)register resources, so do not hold on to
+            // iterators or references while the resource is called.
+            for (uint32_t index = 0; index < _evaluate.size(); index++) {
+                const IResource::handle descriptor = _evaluate[index];
+                typename Registrations::iterator entry(_registrations.find(descriptor));
+
+                if (entry != _registrations.end()) {
+                    RESOURCE* resource = entry->second.resource;
+                    const uint16_t events = resource->Events();
+                    const IResource::handle current = resource->Descriptor();
+
+                    entry = _registrations.find(descriptor);
+
+                    if ((entry == _registrations.end()) || (entry->second.resource != resource)) {
+                        // It took care of its own unregistration.
+                    } else if (events == 0) {
+                        if (entry->second.monitor != 0) {
+                            ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+                        }
+                        _registrations.erase(entry);
+                    } else {
+                        if (current != descriptor) {
+                            // The resource swapped its descriptor (e.g. a listening socket that
+                            // accepted a connection on itself), follow it.
+                            if (entry->second.monitor != 0) {
+                                ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+                            }
+                            _registrations.erase(entry);
+                            _registrations[current] = Registration { resource, 0, 0 };
+                            entry = _registrations.find(current);
+                        }
+
+                        struct ::epoll_event interest;
+                        interest.events = events | TriggerMode;
+                        interest.data.fd = current;
+
+                        if (entry->second.monitor == 0) {
+                            if ((::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, current, &interest) != 0) && ((errno != EEXIST) || (::epoll_ctl(_epollDescriptor, EPOLL_CTL_MOD, current, &interest) != 0))) {
+                                TRACE_L1("Could not monitor descriptor %d, error <%d>", current, errno);
+                            }
+                        }
+#ifdef __CORE_RESOURCE_MONITOR_EDGE_TRIGGERED__
+                        // Always re-arm, so a condition that is still pending is reported again.
+                        else if ((::epoll_ctl(_epollDescriptor, EPOLL_CTL_MOD, current, &interest) != 0) && (errno == ENOENT)) {
+#else
+                        else if ((events != entry->second.monitor) && (::epoll_ctl(_epollDescriptor, EPOLL_CTL_MOD, current, &interest) != 0) && (errno == ENOENT)) {
+#endif
+                            // The resource closed and reopened its descriptor (e.g. a listening socket
+                            // that goes back to listening), the kernel dropped the old one from the set.
+                            if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, current, &interest) != 0) {
+                                TRACE_L1("Could not monitor descriptor %d, error <%d>", current, errno);
+                            }
+                        }
+
+                        entry->second.monitor = events;
+                    }
+                }
+            }
+
+            _evaluate.clear();
+        }
+        void Dispatch()
+        {
+            for (const IResource::handle descriptor : _ready) {
+                typename Registrations::iterator index(_registrations.find(descriptor));
+
+                // The entry might have been removed from observing in the mean time, or replaced
+                // by a resource that was not evaluated yet.
+                if ((index != _registrations.end()) && (index->second.monitor != 0)) {
+                    RESOURCE* entry = index->second.resource;
+                    uint16_t flagsSet = index->second.events;
+
+                    index->second.events = 0;
+
+                    Arm();
+
+                    // Event if the flagsSet == 0, call handle, maybe a break was issued by this RESOURCE..
+                    entry->Handle(flagsSet);
+
+                    Reset();
+
+                    _evaluate.push_back(descriptor);
+                }
+            }
+
+            _ready.clear();
+        }
+#endif
+
     private:
         MonitorWorker* _monitor;
         mutable Core::CriticalSection _adminLock;
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+        Registrations _registrations;
+        std::vector<IResource::handle> _evaluate;
+        std::vector<IResource::handle> _ready;
+        std::atomic<bool> _breakIssued;
+        Core::CriticalSection _pendingLock;
+        std::vector<const RESOURCE*> _pending;
+        std::vector<const RESOURCE*> _collected;
+#else
         std::list<RESOURCE*> _resourceList;
+#endif
         uint32_t _monitorRuns;
+        mutable Core::CriticalSection _parkingLock;
+        std::vector<RESOURCE*> _parked;
+        std::vector<std::pair<Parent*, RESOURCE*>> _handovers;
+        std::atomic<bool> _wakeupPending;
+        std::atomic<uint32_t> _wakeupRequests;
+        std::atomic<uint32_t> _wakeups;
+        uint32_t _ioEvents;
         string _name;
         WATCHDOG _watchDog;
 
 #ifdef __LINUX__
+#ifdef __CORE_RESOURCE_MONITOR_EPOLL__
+        int _signalDescriptor;
+        int _epollDescriptor;
+        struct ::epoll_event _eventArray[EventAllocation];
+#else
         uint32_t _descriptorArrayLength;
         struct ::pollfd* _descriptorArray;
         int _signalDescriptor;
 #endif
+#endif
 
 #ifdef __WINDOWS__
         HANDLE _action;
@@ -565,20 +1077,117 @@ namespace Core {
     typedef ResourceMonitorType<IResource, Void> ResourceMonitorBase;
 #endif
 
-    class EXTERNAL ResourceMonitor : public ResourceMonitorBase {
+    // The ResourceMonitor spreads the resources over one or more monitors, each with their own
+    // thread. A resource is assigned to a monitor by hashing its address, so all calls for the
+    // same resource end up at the same monitor, without any administration.
+    class EXTERNAL ResourceMonitor {
     private:
-        ResourceMonitor()
-            : ResourceMonitorBase()
-        {
-        }
+        ResourceMonitor();
         ResourceMonitor(const ResourceMonitor&) = delete;
         ResourceMonitor& operator=(const ResourceMonitor&) = delete;
 
         friend class SingletonType<ResourceMonitor>;
 
+    public:
+        typedef ResourceMonitorBase::Metadata Metadata;
+
     public:
         static ResourceMonitor& Instance();
-        ~ResourceMonitor() {}
+        ~ResourceMonitor();
+
+    public:
+        // The number of monitors can only be changed as long as no resources are registered.
+        bool Monitors(const uint8_t count);
+        uint8_t Monitors() const
+        {
+            return (static_cast<uint8_t>(_monitors.size()));
+        }
+        const TCHAR* Name() const
+        {
+            return (_monitors[0]->Name());
+        }
+        ::ThreadId Id() const
+        {
+            return (_monitors[0]->Id());
+        }
+        ::ThreadId Id(const uint8_t index) const
+        {
+            return (index < _monitors.size() ? _monitors[index]->Id() : 0);
+        }
+        bool HasThread(const ::ThreadId id) const
+        {
+            uint8_t index = 0;
+            while ((index < _monitors.size()) && (_monitors[index]->Id() != id)) {
+                index++;
+            }
+            return (index < _monitors.size());
+        }
+        uint32_t Runs() const;
+        uint32_t WakeupRequests() const;
+        uint32_t Wakeups() const;
+        uint32_t IOEvents() const;
+        uint32_t Count() const;
+        bool Info(const uint32_t position, Metadata& info) const;
+
+        void Register(IResource& resource)
+        {
+            ResourceMonitorBase& monitor = Select(resource);
+            ResourceMonitorBase* caller = Caller();
+
+            if ((caller == nullptr) || (caller == &monitor)) {
+                monitor.Register(resource);
+            } else {
+                monitor.Register(resource, *caller);
+            }
+        }
+        void Unregister(IResource& resource)
+        {
+            Select(resource).Unregister(resource);
+        }
+        // Have the monitor that owns this resource re-evaluate it.
+        void Break(const IResource& resource)
+        {
+            Select(resource).Break(resource);
+        }
+        // Have all monitors re-evaluate all their resources.
+        void Break();
+
+    private:
+        // The monitor on whose thread we are running, if any. With a single monitor it does not matter.
+        ResourceMonitorBase* Caller() const
+        {
+            ResourceMonitorBase* result = nullptr;
+
+            if (_monitors.size() > 1) {
+                const ::ThreadId id = Thread::ThreadId();
+                uint8_t index = 0;
+
+                while ((index < _monitors.size()) && (_monitors[index]->Id() != id)) {
+                    index++;
+                }
+                if (index < _monitors.size()) {
+                    result = _monitors[index];
+                }
+            }
+
+            return (result);
+        }
+        ResourceMonitorBase& Select(const IResource& resource) const
+        {
+            uint8_t index = 0;
+
+            if (_monitors.size() > 1) {
+                // Resources are heap or member objects, skip the bits that are determined by the
+                // alignment and spread the rest (Fibonacci hashing).
+                const uint64_t key = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&resource)) >> 4) * 0x9E3779B97F4A7C15ULL;
+                index = static_cast<uint8_t>((key >> 32) % _monitors.size());
+            }
+
+            return (*_monitors[index]);
+        }
+
+    private:
+        std::vector<ResourceMonitorBase*> _monitors;
     };
 }
 } // namespace WPEFramework::Core
@@ -612,7 +612,7 @@ namespace Core {
             // subscribtion.
             _state |= SerialPort::EXCEPTION;
             _state &= ~SerialPort::OPEN;
-            ResourceMonitor::Instance().Break();
+            ResourceMonitor::Instance().Break(*this);
         } 
 #endif
 
@@ -644,7 +644,7 @@ namespace Core {
             // Right, a wait till connection is closed is requested..
             while ((waiting > 0) && (_state != 0)) {
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().HasThread(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -678,7 +678,7 @@ namespace Core {
 #else
     if ((_state & (SerialPort::OPEN | SerialPort::EXCEPTION | SerialPort::WRITESLOT)) == SerialPort::OPEN) {
         _state |= SerialPort::WRITESLOT;
-        ResourceMonitor::Instance().Break();
+        ResourceMonitor::Instance().Break(*this);
     }
 #endif
 
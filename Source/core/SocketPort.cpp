@@ -595,7 +595,7 @@ namespace WPEFramework {
 #endif
                     }
 
-                    ResourceMonitor::Instance().Break();
+                    ResourceMonitor::Instance().Break(*this);
                 }
 
                 if (waitTime > 0) {
@@ -607,7 +607,7 @@ namespace WPEFramework {
 
                         // We probably did not get a response from the otherside on the close
                         // sloppy but let's forcefully close it
-                        ResourceMonitor::Instance().Break();
+                        ResourceMonitor::Instance().Break(*this);
 
                         closed = (WaitForClosure(Core::infinite) == Core::ERROR_NONE);
 
@@ -628,7 +628,7 @@ namespace WPEFramework {
             if ((m_State & (SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) {
 
                 m_State |= SocketPort::WRITESLOT;
-                ResourceMonitor::Instance().Break();
+                ResourceMonitor::Instance().Break(*this);
             }
             m_syncAdmin.Unlock();
         }
@@ -878,7 +878,7 @@ namespace WPEFramework {
             // Right, a wait till connection is closed is requested..
             while ((waiting > 0) && (IsOpen() == false)) {
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().HasThread(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -913,7 +913,7 @@ namespace WPEFramework {
                     break;
                 }
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().HasThread(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -942,7 +942,7 @@ namespace WPEFramework {
             // Right, a wait till connection is closed is requested..
             while ((waiting > 0) && (IsClosed() == false)) {
                 // Make sure we aren't in the monitor thread waiting for close completion.
-                ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+                ASSERT(ResourceMonitor::Instance().HasThread(Core::Thread::ThreadId()) == false);
 
                 uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -1230,8 +1230,9 @@ namespace WPEFramework {
                 result = false;
             }
             else {
-                DestroySocket(m_Socket);
+                // Unregister before closing, so the monitor can still drop the descriptor from its set.
                 ResourceMonitor::Instance().Unregister(*this);
+                DestroySocket(m_Socket);
                 // Remove socket descriptor for UNIX domain datagram socket.
                 if ((m_LocalNode.Type() == NodeId::TYPE_DOMAIN) &&
                     ((m_SocketType == SocketPort::LISTEN) || (SocketMode() != SOCK_STREAM)) &&
@@ -275,7 +275,7 @@ POP_WARNING()
 #ifdef __POSIX__
         Event m_sigExit;
         pthread_t m_hThreadInstance;
-        uint32_t m_ThreadId;
+        ::ThreadId m_ThreadId;
 #endif
 
 #ifdef __WINDOWS__
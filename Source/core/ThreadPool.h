@@ -22,6 +22,9 @@
 #include "Thread.h"
 #include "ResourceMonitor.h"
 #include "Number.h"
+#include "LockFreeQueue.h"
+
+#include <deque>
 
 namespace WPEFramework {
 
@@ -29,6 +32,14 @@ namespace Core {
 
     class EXTERNAL ThreadPool {
     public:
+        // Jobs are queued in a lane of their own priority, the lanes are served in this order.
+        enum priority : uint8_t {
+            CRITICAL,
+            NORMAL,
+            BULK
+        };
+        static constexpr uint8_t Priorities = BULK + 1;
+
         struct EXTERNAL IJob : public IDispatch {
             ~IJob() override = default;
 
@@ -38,6 +49,12 @@ namespace Core {
             virtual ~IScheduler() = default;
 
             virtual void Schedule(const Time& time, const ProxyType<IDispatch>& job) = 0;
+
+            // Override this one if the scheduled job should return to the lane it came from.
+            virtual void Schedule(const Time& time, const ProxyType<IDispatch>& job, const priority /* lane */)
+            {
+                Schedule(time, job);
+            }
         };
         struct EXTERNAL IDispatcher {
             virtual ~IDispatcher() = default;
@@ -51,6 +68,13 @@ namespace Core {
             uint32_t                    Runs;
             Core::OptionalType<string>  Job;
         };
+        struct EXTERNAL LaneMetadata {
+            priority                    Lane;
+            uint32_t                    Pending;
+            uint32_t                    Dispatched;
+            uint32_t                    AverageWait; // in microseconds
+            uint32_t                    MaximumWait; // in microseconds
+        };
 
         #ifdef __CORE_WARNING_REPORTING__
         struct EXTERNAL DispatchedJobMetaData {
@@ -136,14 +160,210 @@ namespace Core {
             {
                 return _job.IsValid();
             }
+            uint64_t Queued() const
+            {
+                return (_time);
+            }
 
         private:
             ProxyType<IDispatch> _job;
             uint64_t _time;
         };
-        typedef QueueType< MeasurableJob > MessageQueue;
+        typedef MeasurableJob QueuedJob;
         #else
-        typedef QueueType< ProxyType<IDispatch> > MessageQueue;
+        class QueuedJob {
+        public:
+            // Not explicit on purpose, the queues take a ProxyType<IDispatch> as well.
+            QueuedJob()
+                : _job()
+                , _time(0)
+            {
+            }
+            QueuedJob(const ProxyType<IDispatch>& job)
+                : _job(job)
+                , _time(Time::Now().Ticks())
+            {
+            }
+            QueuedJob(const QueuedJob&) = default;
+            ~QueuedJob() = default;
+
+            QueuedJob& operator=(const QueuedJob&) = default;
+
+        public:
+            bool operator==(const QueuedJob& other) const
+            {
+                return (_job == other._job);
+            }
+            bool operator!=(const QueuedJob& other) const
+            {
+                return (_job != other._job);
+            }
+            bool IsValid() const
+            {
+                return (_job.IsValid());
+            }
+            uint64_t Queued() const
+            {
+                return (_time);
+            }
+            const ProxyType<IDispatch>& Job() const
+            {
+                return (_job);
+            }
+            void Release()
+            {
+                _job.Release();
+            }
+
+        private:
+            ProxyType<IDispatch> _job;
+            uint64_t _time;
+        };
+        #endif
+
+        #ifdef __CORE_LOCKFREE_JOB_QUEUE__
+        typedef LockFreeQueueType< QueuedJob > MessageQueue;
+        #else
+        typedef QueueType< QueuedJob > MessageQueue;
+        #endif
+
+        class Lane {
+        public:
+            Lane() = delete;
+            Lane(const Lane&) = delete;
+            Lane& operator=(const Lane&) = delete;
+
+            Lane(const uint32_t queueSize)
+                : _queue(queueSize)
+                , _dispatched(0)
+                , _waited(0)
+                , _maximum(0)
+            {
+            }
+            ~Lane() = default;
+
+        public:
+            MessageQueue& Queue()
+            {
+                return (_queue);
+            }
+            const MessageQueue& Queue() const
+            {
+                return (_queue);
+            }
+            void Dispatched(const uint64_t queued)
+            {
+                const uint64_t now = Time::Now().Ticks();
+                const uint64_t waited = (now > queued ? now - queued : 0);
+                uint64_t maximum = _maximum.load(std::memory_order_relaxed);
+
+                _dispatched.fetch_add(1, std::memory_order_relaxed);
+                _waited.fetch_add(waited, std::memory_order_relaxed);
+
+                while ((waited > maximum) && (_maximum.compare_exchange_weak(maximum, waited, std::memory_order_relaxed) == false)) {
+                }
+            }
+            void Info(LaneMetadata& info) const
+            {
+                const uint32_t dispatched = _dispatched.load(std::memory_order_relaxed);
+
+                info.Pending = _queue.Length();
+                info.Dispatched = dispatched;
+                // Ticks are microseconds.
+                info.AverageWait = (dispatched == 0 ? 0 : static_cast<uint32_t>(_waited.load(std::memory_order_relaxed) / dispatched));
+                info.MaximumWait = static_cast<uint32_t>(_maximum.load(std::memory_order_relaxed));
+            }
+
+        private:
+            MessageQueue _queue;
+            std::atomic<uint32_t> _dispatched;
+            std::atomic<uint64_t> _waited;
+            std::atomic<uint64_t> _maximum;
+        };
+
+        #ifdef __CORE_WORK_STEALING__
+        // Jobs submitted by a minion are kept on the local queue of that minion. The owner and
+        // the thieves both take the oldest job, so a job that keeps resubmitting itself can not
+        // starve the others. The lock is (almost) never contended, it is not on a shared path.
+        class LocalQueue {
+        public:
+            LocalQueue(const LocalQueue&) = delete;
+            LocalQueue& operator=(const LocalQueue&) = delete;
+
+            LocalQueue()
+                : _adminLock()
+                , _jobs()
+                , _count(0)
+            {
+            }
+            ~LocalQueue() = default;
+
+        public:
+            uint32_t Length() const
+            {
+                return (_count.load(std::memory_order_relaxed));
+            }
+            void Push(const QueuedJob& job)
+            {
+                _adminLock.Lock();
+                _jobs.push_back(job);
+                _count.store(static_cast<uint32_t>(_jobs.size()), std::memory_order_seq_cst);
+                _adminLock.Unlock();
+            }
+            bool Pop(QueuedJob& job)
+            {
+                bool result = false;
+
+                if (_count.load(std::memory_order_acquire) > 0) {
+                    _adminLock.Lock();
+                    if (_jobs.empty() == false) {
+                        job = _jobs.front();
+                        _jobs.pop_front();
+                        _count.store(static_cast<uint32_t>(_jobs.size()), std::memory_order_release);
+                        result = true;
+                    }
+                    _adminLock.Unlock();
+                }
+
+                return (result);
+            }
+            // Take back the most recent job, to hand it to a minion that is idle.
+            bool Reclaim(QueuedJob& job)
+            {
+                bool result = false;
+
+                _adminLock.Lock();
+                if (_jobs.empty() == false) {
+                    job = _jobs.back();
+                    _jobs.pop_back();
+                    _count.store(static_cast<uint32_t>(_jobs.size()), std::memory_order_release);
+                    result = true;
+                }
+                _adminLock.Unlock();
+
+                return (result);
+            }
+            bool Remove(const QueuedJob& job)
+            {
+                bool result = false;
+
+                _adminLock.Lock();
+                typename std::deque<QueuedJob>::iterator index = std::find(_jobs.begin(), _jobs.end(), job);
+                if (index != _jobs.end()) {
+                    _jobs.erase(index);
+                    _count.store(static_cast<uint32_t>(_jobs.size()), std::memory_order_release);
+                    result = true;
+                }
+                _adminLock.Unlock();
+
+                return (result);
+            }
+
+        private:
+            mutable CriticalSection _adminLock;
+            std::deque<QueuedJob> _jobs;
+            std::atomic<uint32_t> _count;
+        };
         #endif
 
     public:   
@@ -192,6 +412,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _state(IDLE)
                 , _job(*this)
                 , _time()
+                , _priority(NORMAL)
             {
                 _job.AddRef();
             }
@@ -206,6 +427,12 @@ POP_WARNING()
             bool IsIdle() const {
                 return (_state == IDLE);
             }
+            priority Priority() const {
+                return (_priority);
+            }
+            void Priority(const priority lane) {
+                _priority = lane;
+            }
             ProxyType<IDispatch> Idle() {
 
                 state idle = IDLE;
@@ -344,6 +571,7 @@ POP_WARNING()
             std::atomic<state> _state;
             ProxyObject<Worker> _job;
             Time _time;
+            priority _priority;
         };
 
         class EXTERNAL Minion {
@@ -359,6 +587,9 @@ POP_WARNING()
                 , _interestCount(0)
                 , _currentRequest()
                 , _runs(0)
+                #ifdef __CORE_WORK_STEALING__
+                , _local()
+                #endif
             {
                 ASSERT(dispatcher != nullptr);
             }
@@ -397,9 +628,11 @@ POP_WARNING()
             }
             void Process()
             {
+                priority lane;
+
                 _dispatcher->Initialize();
 
-                while (_parent._queue.Extract(_currentRequest, infinite) == true) {
+                while (_parent.Extract(*this, _currentRequest, lane) == true) {
 
                     ASSERT(_currentRequest.IsValid() == true);
 
@@ -419,7 +652,7 @@ POP_WARNING()
 
                     if (job != nullptr) {
                         // Maybe we need to reschedule this request....
-                        _parent.Closure(*job);
+                        _parent.Closure(*job, lane);
                     }
                     #else
                     IDispatch* request = &(*_currentRequest);
@@ -430,7 +663,7 @@ POP_WARNING()
 
                     if (job != nullptr) {
                         // Maybe we need to reschedule this request....
-                        _parent.Closure(*job);
+                        _parent.Closure(*job, lane);
                     }
 
                     #endif
@@ -456,6 +689,16 @@ POP_WARNING()
 
                 _dispatcher->Deinitialize();
             }
+            #ifdef __CORE_WORK_STEALING__
+            LocalQueue& Local()
+            {
+                return (_local);
+            }
+            const LocalQueue& Local() const
+            {
+                return (_local);
+            }
+            #endif
 
         private:
             ThreadPool& _parent;
@@ -469,6 +712,9 @@ POP_WARNING()
             ProxyType<IDispatch> _currentRequest;
             #endif
             uint32_t _runs;
+            #ifdef __CORE_WORK_STEALING__
+            LocalQueue _local;
+            #endif
         };
 
     private:
@@ -503,6 +749,9 @@ POP_WARNING()
             Minion& Me() {
                 return (_minion);
             }
+            const Minion& Me() const {
+                return (_minion);
+            }
 
         private:
             uint32_t Worker() override
@@ -521,8 +770,12 @@ POP_WARNING()
         ThreadPool& operator=(const ThreadPool& a_RHS) = delete;
 
         ThreadPool(const uint8_t count, const uint32_t stackSize, const uint32_t queueSize, IDispatcher* dispatcher, IScheduler* scheduler) 
-            : _queue(queueSize)
+            : _lanes{ { queueSize }, { queueSize }, { queueSize } }
             , _scheduler(scheduler)
+            , _work(0, NumberType<int32_t>::Max())
+            , _active(false)
+            , _sleeping(0)
+            , _wakeups(0)
             #ifdef __CORE_WARNING_REPORTING__
             , _dispatchedJobMonitor(nullptr)
             #endif
@@ -544,7 +797,19 @@ POP_WARNING()
         }
         uint32_t Pending() const
         {
-            return (_queue.Length());
+            uint32_t pending = 0;
+
+            for (uint8_t index = 0; index < Priorities; index++) {
+                pending += _lanes[index].Queue().Length();
+            }
+
+            #ifdef __CORE_WORK_STEALING__
+            for (const Executor& unit : _units) {
+                pending += unit.Me().Local().Length();
+            }
+            #endif
+
+            return (pending);
         }
         void Info(const uint8_t length, Metadata* entries) const 
         {
@@ -556,6 +821,22 @@ POP_WARNING()
                 count++; 
             }
         }
+        void Lanes(const uint8_t length, LaneMetadata* entries) const
+        {
+            for (uint8_t index = 0; (index < length) && (index < Priorities); index++) {
+                _lanes[index].Info(entries[index]);
+                entries[index].Lane = static_cast<priority>(index);
+            }
+
+            #ifdef __CORE_WORK_STEALING__
+            // Jobs kept by the minions are normal jobs that did not make it to the shared lane.
+            if (length > NORMAL) {
+                for (const Executor& unit : _units) {
+                    entries[NORMAL].Pending += unit.Me().Local().Length();
+                }
+            }
+            #endif
+        }
         ::ThreadId Id(const uint8_t index) const
         {
             uint8_t count = 0;
@@ -566,18 +847,22 @@ POP_WARNING()
 
             return (ptr != _units.cend() ? ptr->Id() : 0);
         }
-        void Submit(const ProxyType<IDispatch>& job, const uint32_t waitTime)
+        void Submit(const ProxyType<IDispatch>& job, const uint32_t waitTime, const priority lane = NORMAL)
         {
             ASSERT(job.IsValid() == true);
-            ASSERT(_queue.HasEntry(job) == false);
+            ASSERT(lane < Priorities);
+            ASSERT(IsQueued(job) == false);
 
-            if (Thread::ThreadId() == ResourceMonitor::Instance().Id()) {
-                _queue.Post(job);
+            if ((lane == NORMAL) && (Keep(job) == true)) {
+                // Submitted by one of our own minions, it stays with that minion.
             }
-            else {
-                _queue.Insert(job, waitTime);
+            else if (ResourceMonitor::Instance().HasThread(Thread::ThreadId()) == true) {
+                _lanes[lane].Queue().Post(job);
+                Wake();
+            }
+            else if (_lanes[lane].Queue().Insert(job, waitTime) == true) {
+                Wake();
             }
-
         }
         uint32_t Revoke(const ProxyType<IDispatch>& job, const uint32_t waitTime)
         {
@@ -585,7 +870,7 @@ POP_WARNING()
 
             ASSERT(job.IsValid() == true);
 
-            if (_queue.Remove(job) == true) {
+            if ((Remove(job) == true) || (Withdraw(job) == true)) {
                 result = ERROR_NONE;
             }
             else {
@@ -612,7 +897,10 @@ POP_WARNING()
         }
         void Run()
         {
-            _queue.Enable();
+            _active.store(true, std::memory_order_seq_cst);
+            for (uint8_t index = 0; index < Priorities; index++) {
+                _lanes[index].Queue().Enable();
+            }
             std::list<Executor>::iterator index = _units.begin();
             while (index != _units.end()) {
                 index->Run();
@@ -621,7 +909,18 @@ POP_WARNING()
         }
         void Stop()
         {
-            _queue.Disable();
+            _active.store(false, std::memory_order_seq_cst);
+            for (uint8_t index = 0; index < Priorities; index++) {
+                _lanes[index].Queue().Disable();
+            }
+
+            // Whoever announced a nap before we turned inactive, needs a kick.
+            const uint32_t sleeping = _sleeping.load(std::memory_order_seq_cst);
+            if (sleeping > 0) {
+                _wakeups.fetch_add(sleeping, std::memory_order_relaxed);
+                _work.Unlock(sleeping);
+            }
+
             std::list<Executor>::iterator index = _units.begin();
             while (index != _units.end()) {
                 index->Stop();
@@ -650,26 +949,214 @@ POP_WARNING()
         }
         #endif
     private:
-        void Closure(IJob& job) {
+        #ifndef __CORE_WARNING_REPORTING__
+        bool Extract(Minion& minion, ProxyType<IDispatch>& job, priority& lane)
+        {
+            QueuedJob entry;
+
+            bool result = Extract(minion, entry, lane);
+
+            if (result == true) {
+                job = entry.Job();
+            }
+
+            return (result);
+        }
+        #endif
+        bool Extract(Minion& minion, QueuedJob& job, priority& lane)
+        {
+            bool result = false;
+
+            while ((result == false) && (_active.load(std::memory_order_acquire) == true)) {
+
+                result = Fetch(minion, job, lane);
+
+                if (result == false) {
+                    // Announce the nap before the last look, a poster either sees us or we see its job.
+                    _sleeping.fetch_add(1, std::memory_order_seq_cst);
+
+                    result = Fetch(minion, job, lane);
+
+                    if ((result == false) && (_active.load(std::memory_order_seq_cst) == true)) {
+                        _work.Lock(infinite);
+                        _wakeups.fetch_sub(1, std::memory_order_relaxed);
+                    }
+
+                    _sleeping.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            if (result == true) {
+                _lanes[lane].Dispatched(job.Queued());
+            }
+
+            return (result);
+        }
+        bool Take(const priority lane, QueuedJob& job)
+        {
+            return (_lanes[lane].Queue().Extract(job, 0));
+        }
+        void Wake()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Only kick a sleeper if there is no kick underway for it already.
+            if (_sleeping.load(std::memory_order_relaxed) > _wakeups.load(std::memory_order_relaxed)) {
+                _wakeups.fetch_add(1, std::memory_order_relaxed);
+                _work.Unlock(1);
+            }
+        }
+        bool Remove(const ProxyType<IDispatch>& job)
+        {
+            bool result = false;
+
+            for (uint8_t index = 0; (result == false) && (index < Priorities); index++) {
+                result = _lanes[index].Queue().Remove(job);
+            }
+
+            return (result);
+        }
+        bool IsQueued(const ProxyType<IDispatch>& job) const
+        {
+            bool result = false;
+
+            for (uint8_t index = 0; (result == false) && (index < Priorities); index++) {
+                result = _lanes[index].Queue().HasEntry(job);
+            }
+
+            return (result);
+        }
+        #ifdef __CORE_WORK_STEALING__
+        // Urgent work first, than our own, than the rest of the shared work and only than other peoples work.
+        bool Fetch(Minion& minion, QueuedJob& job, priority& lane)
+        {
+            bool result = true;
+
+            if (Take(CRITICAL, job) == true) {
+                lane = CRITICAL;
+            }
+            else if ((minion.Local().Pop(job) == true) || (Take(NORMAL, job) == true)) {
+                lane = NORMAL;
+            }
+            else if (Take(BULK, job) == true) {
+                lane = BULK;
+            }
+            else if (Steal(minion, job) == true) {
+                lane = NORMAL;
+            }
+            else {
+                result = false;
+            }
+
+            return (result);
+        }
+        bool Steal(Minion& thief, QueuedJob& job)
+        {
+            bool result = false;
+            std::list<Executor>::iterator index = _units.begin();
+
+            while ((result == false) && (index != _units.end())) {
+                if (&(index->Me()) != &thief) {
+                    result = index->Me().Local().Pop(job);
+                }
+                index++;
+            }
+
+            return (result);
+        }
+        bool Keep(const ProxyType<IDispatch>& job)
+        {
+            Minion* minion = nullptr;
+            const ::ThreadId id = Thread::ThreadId();
+            std::list<Executor>::iterator index = _units.begin();
+
+            while ((minion == nullptr) && (index != _units.end())) {
+                if (index->Id() == id) {
+                    minion = &(index->Me());
+                }
+                index++;
+            }
+
+            if (minion != nullptr) {
+                minion->Local().Push(job);
+
+                // If a minion went to sleep in the mean time, it is waiting for the shared lanes.
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (_sleeping.load(std::memory_order_relaxed) > 0) {
+                    QueuedJob offer;
+
+                    if (minion->Local().Reclaim(offer) == true) {
+                        _lanes[NORMAL].Queue().Post(offer);
+                        Wake();
+                    }
+                }
+            }
+
+            return (minion != nullptr);
+        }
+        bool Withdraw(const ProxyType<IDispatch>& job)
+        {
+            bool result = false;
+            std::list<Executor>::iterator index = _units.begin();
+
+            while ((result == false) && (index != _units.end())) {
+                result = index->Me().Local().Remove(job);
+                index++;
+            }
+
+            return (result);
+        }
+        #else
+        bool Fetch(Minion&, QueuedJob& job, priority& lane)
+        {
+            uint8_t index = 0;
+
+            while ((index < Priorities) && (Take(static_cast<priority>(index), job) == false)) {
+                index++;
+            }
+
+            lane = static_cast<priority>(index);
+
+            return (index < Priorities);
+        }
+        bool Keep(const ProxyType<IDispatch>&)
+        {
+            return (false);
+        }
+        bool Withdraw(const ProxyType<IDispatch>&)
+        {
+            return (false);
+        }
+        #endif
+        void Closure(IJob& job, const priority lane) {
             Time scheduleTime;
-            _queue.Lock();
+            MessageQueue& queue(_lanes[lane].Queue());
+            queue.Lock();
             ProxyType<IDispatch> resubmit = job.Resubmit(scheduleTime);
             if (resubmit.IsValid() == true) {
                 if ((scheduleTime.IsValid() == false) || (_scheduler == nullptr) || (scheduleTime < Time::Now()) ) {
-                    _queue.Post(resubmit);
+                    if ((lane != NORMAL) || (Keep(resubmit) == false)) {
+                        queue.Post(resubmit);
+                        Wake();
+                    }
                 }
                 else {
                     // See if we have a hook that can process scheduled entries :-)
-                    _scheduler->Schedule(scheduleTime, resubmit);
+                    _scheduler->Schedule(scheduleTime, resubmit, lane);
                 }
             }
-            _queue.Unlock();
+            queue.Unlock();
         }
 
     private:
-        MessageQueue _queue;
+        Lane _lanes[Priorities];
         std::list<Executor> _units;
         IScheduler* _scheduler;
+        CountingSemaphore _work;
+        std::atomic<bool> _active;
+        std::atomic<uint32_t> _sleeping;
+        std::atomic<uint32_t> _wakeups;
         #ifdef __CORE_WARNING_REPORTING__
         IDispatchedJobMonitor* _dispatchedJobMonitor;
         #endif
@@ -27,7 +27,9 @@
 #include "Sync.h"
 #include "Thread.h"
 #include "Time.h"
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 // ---- Referenced classes and types ----
 
@@ -152,15 +154,52 @@ namespace Core {
             TimerType<CONTENT>& m_Parent;
         };
 
-        using TimeInfoBlocks = TimedInfo<CONTENT>;
-        using SubscriberList = typename std::list<TimeInfoBlocks>;
+        // The pending entries live in a list (stable iterators) and are ordered through a binary
+        // min-heap of iterators into that list. Entries with the same schedule time keep their
+        // insertion order, so scheduling, firing and removing an entry costs O(log n).
+        // If CONTENT offers a "size_t Hash() const" that is consistent with its operator==, the
+        // entries are indexed on it as well and Revoke()/Trigger()/HasEntry() no longer have to
+        // scan all pending entries.
+        class Entry {
+        public:
+            Entry() = delete;
+            Entry(const Entry&) = delete;
+            Entry& operator=(const Entry&) = delete;
+
+            Entry(TimedInfo<CONTENT>&& info, const uint64_t sequence)
+                : Info(std::move(info))
+                , Sequence(sequence)
+                , Key(0)
+                , Position(0)
+            {
+            }
+            ~Entry() = default;
+
+        public:
+            TimedInfo<CONTENT> Info;
+            uint64_t Sequence;
+            size_t Key;
+            uint32_t Position;
+        };
+
+        using EntryList = std::list<Entry>;
+        using EntryIterator = typename EntryList::iterator;
+        using Heap = std::vector<EntryIterator>;
+        using Index = std::unordered_multimap<size_t, EntryIterator>;
+
+        static constexpr uint32_t NotFound = NUMBER_MAX_UNSIGNED(uint32_t);
+
+        IS_MEMBER_AVAILABLE(Hash, hasHash);
 
     public:
         TimerType(const TimerType&) = delete;
         TimerType& operator=(const TimerType&) = delete;
 
         TimerType(const uint32_t stackSize, const TCHAR* timerName)
-            : _pendingQueue()
+            : _entries()
+            , _heap()
+            , _index()
+            , _sequence(0)
             , _timerThread(*this, stackSize, timerName)
             , _adminLock()
             , _nextTrigger(NUMBER_MAX_UNSIGNED(uint64_t))
@@ -178,7 +217,7 @@ namespace Core {
             _timerThread.Stop();
 
             // Force kill on all pending stuff...
-            _pendingQueue.clear();
+            Clear();
 
             _adminLock.Unlock();
 
@@ -211,7 +250,7 @@ namespace Core {
             _timerThread.Block();
 
             // Force kill on all pending stuff...
-            _pendingQueue.clear();
+            Clear();
             _adminLock.Unlock();
 
             _timerThread.Wait(Thread::BLOCKED, Core::infinite);
@@ -222,14 +261,7 @@ namespace Core {
             // This needs to be atomic. Make sure it is.
             _adminLock.Lock();
 
-            typename SubscriberList::const_iterator index = _pendingQueue.cbegin();
-
-            // Clear all entries !!
-            while ((index != _pendingQueue.cend()) && (*index != element)) {
-                index++;
-            }
-
-            bool found = (index != _pendingQueue.cend());
+            bool found = (Find(element) != NotFound);
 
             // Done with the administration. Release the lock.
             _adminLock.Unlock();
@@ -256,14 +288,10 @@ namespace Core {
 
             _adminLock.Lock();
 
-            typename SubscriberList::iterator index = _pendingQueue.begin();
+            uint32_t position = Find(info);
 
-            while ((index != _pendingQueue.end()) && ((*index).Content() != info)) {
-                ++index;
-            }
-
-            if (index != _pendingQueue.end()) {
-                _pendingQueue.erase(index);
+            if (position != NotFound) {
+                Remove(_heap[position]);
             }
 
             if (ScheduleEntry(std::move(newEntry)) == true) {
@@ -291,25 +319,12 @@ namespace Core {
                 _adminLock.Lock();
             }
 
-            typename SubscriberList::iterator index = _pendingQueue.begin();
-
             bool changedHead = false;
 
-            while (index != _pendingQueue.end()) {
-                if (index->Content() == info) {
-                    changedHead |= (index == _pendingQueue.begin());
-                    foundElement = true;
-
-                    // Remove this... Found it, remove it.
-                    index = _pendingQueue.erase(index);
-                }
-                else {
-                    ++index;
-                }
-            }
+            foundElement = RemoveAll(info, changedHead);
 
             if (changedHead == true) {
-                // If we added the new time up front, retrigger the scheduler.
+                // If we removed the first entry, retrigger the scheduler.
                 _timerThread.Run();
             }
 
@@ -325,7 +340,7 @@ namespace Core {
 
         uint32_t Pending() const
         {
-            return (_pendingQueue.size());
+            return (static_cast<uint32_t>(_entries.size()));
         }
 
         ::ThreadId ThreadId() const
@@ -345,12 +360,13 @@ namespace Core {
             // Ranging from 0-Core::infinite
             _timerThread.Block();
 
-            while ((_pendingQueue.empty() == false) && (_pendingQueue.front().ScheduleTime() <= now)) {
-                TimedInfo<CONTENT> info(std::move(_pendingQueue.front()));
+            while ((_heap.empty() == false) && (_heap.front()->Info.ScheduleTime() <= now)) {
+                EntryIterator head(_heap.front());
+                TimedInfo<CONTENT> info(std::move(head->Info));
                 _executing = &(info.Content());
 
                 // Make sure we loose the current one before we do the call, that one might add ;-)
-                _pendingQueue.pop_front();
+                Remove(head);
                 _waitForCompletion.ResetEvent();
 
                 _adminLock.Unlock();
@@ -371,19 +387,19 @@ namespace Core {
             }
 
             // Calculate the delay...
-            if (_pendingQueue.empty() == true) {
+            if (_heap.empty() == true) {
                 _nextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
             } else {
                 // Refresh the time, just to be on the safe side...
                 uint64_t delta = Time::Now().Ticks();
 
-                if (delta >= _pendingQueue.front().ScheduleTime()) {
+                if (delta >= _heap.front()->Info.ScheduleTime()) {
                     _nextTrigger = delta;
                     delayTime = 0;
                 } else {
                     // The windows counter is in 100ns intervals dus we mmoeten even delen door  1000 (us) * 10 ns = 10.000
                     // om de waarde in ms te krijgen.
-                    _nextTrigger = _pendingQueue.front().ScheduleTime();
+                    _nextTrigger = _heap.front()->Info.ScheduleTime();
                     delayTime = static_cast<uint32_t>((_nextTrigger - delta) / Time::TicksPerMillisecond);
                 }
             }
@@ -396,29 +412,214 @@ namespace Core {
     private:
         bool ScheduleEntry(TimedInfo<CONTENT>&& infoBlock)
         {
-            bool reevaluate = false;
-            typename SubscriberList::iterator index = _pendingQueue.begin();
+            _entries.emplace_back(std::move(infoBlock), _sequence++);
+
+            EntryIterator entry(std::prev(_entries.end()));
+
+            Insert(entry);
+
+            _heap.push_back(entry);
+            SiftUp(static_cast<uint32_t>(_heap.size() - 1));
+
+            // If we added the new time up front, retrigger the scheduler.
+            return (entry->Position == 0);
+        }
+        void Remove(EntryIterator entry)
+        {
+            const uint32_t position = entry->Position;
+            const uint32_t last = static_cast<uint32_t>(_heap.size() - 1);
+
+            if (position != last) {
+                Place(position, _heap[last]);
+                _heap.pop_back();
+
+                if ((position > 0) && (Less(_heap[position], _heap[(position - 1) / 2]) == true)) {
+                    SiftUp(position);
+                } else {
+                    SiftDown(position);
+                }
+            } else {
+                _heap.pop_back();
+            }
+
+            Extract(entry);
+
+            _entries.erase(entry);
+        }
+        void Clear()
+        {
+            _index.clear();
+            _heap.clear();
+            _entries.clear();
+        }
+        inline bool Less(const EntryIterator& lhs, const EntryIterator& rhs) const
+        {
+            return ((lhs->Info.ScheduleTime() < rhs->Info.ScheduleTime()) || ((lhs->Info.ScheduleTime() == rhs->Info.ScheduleTime()) && (lhs->Sequence < rhs->Sequence)));
+        }
+        inline void Place(const uint32_t position, EntryIterator entry)
+        {
+            _heap[position] = entry;
+            entry->Position = position;
+        }
+        void SiftUp(uint32_t position)
+        {
+            EntryIterator entry(_heap[position]);
+
+            while (position > 0) {
+                const uint32_t parent = (position - 1) / 2;
+
+                if (Less(entry, _heap[parent]) == false) {
+                    break;
+                }
+
+                Place(position, _heap[parent]);
+                position = parent;
+            }
+
+            Place(position, entry);
+        }
+        void SiftDown(uint32_t position)
+        {
+            EntryIterator entry(_heap[position]);
+            const uint32_t count = static_cast<uint32_t>(_heap.size());
+            uint32_t child;
+
+            while ((child = (2 * position) + 1) < count) {
+
+                if (((child + 1) < count) && (Less(_heap[child + 1], _heap[child]) == true)) {
+                    child++;
+                }
+                if (Less(_heap[child], entry) == false) {
+                    break;
+                }
+
+                Place(position, _heap[child]);
+                position = child;
+            }
+
+            Place(position, entry);
+        }
+
+        // -----------------------------------------------------
+        // Hashed lookup, if the CONTENT supports it.
+        // -----------------------------------------------------
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<hasHash<const SUBJECT, size_t>::value, void>::type
+        Insert(EntryIterator& entry)
+        {
+            entry->Key = entry->Info.Content().Hash();
+            _index.emplace(entry->Key, entry);
+        }
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<!hasHash<const SUBJECT, size_t>::value, void>::type
+        Insert(EntryIterator&)
+        {
+        }
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<hasHash<const SUBJECT, size_t>::value, void>::type
+        Extract(const EntryIterator& entry)
+        {
+            std::pair<typename Index::iterator, typename Index::iterator> range(_index.equal_range(entry->Key));
+
+            while ((range.first != range.second) && (range.first->second != entry)) {
+                ++range.first;
+            }
+
+            ASSERT(range.first != range.second);
+
+            if (range.first != range.second) {
+                _index.erase(range.first);
+            }
+        }
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<!hasHash<const SUBJECT, size_t>::value, void>::type
+        Extract(const EntryIterator&)
+        {
+        }
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<hasHash<const SUBJECT, size_t>::value, bool>::type
+        RemoveAll(const CONTENT& info, bool& changedHead)
+        {
+            bool found = false;
+            std::pair<typename Index::iterator, typename Index::iterator> range(_index.equal_range(info.Hash()));
+
+            while (range.first != range.second) {
+                EntryIterator entry(range.first->second);
+
+                ++range.first;
+
+                if (entry->Info == info) {
+                    changedHead |= (entry->Position == 0);
+                    found = true;
+
+                    Remove(entry);
+                }
+            }
+
+            return (found);
+        }
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<!hasHash<const SUBJECT, size_t>::value, bool>::type
+        RemoveAll(const CONTENT& info, bool& changedHead)
+        {
+            bool found = false;
+            EntryIterator index(_entries.begin());
+
+            while (index != _entries.end()) {
+                EntryIterator entry(index);
 
-            while ((index != _pendingQueue.end()) && (infoBlock.ScheduleTime() >= (*index).ScheduleTime())) {
                 ++index;
+
+                if (entry->Info == info) {
+                    changedHead |= (entry->Position == 0);
+                    found = true;
+
+                    Remove(entry);
+                }
             }
 
-            if (index == _pendingQueue.begin()) {
-                _pendingQueue.push_front(std::move(infoBlock));
+            return (found);
+        }
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<hasHash<const SUBJECT, size_t>::value, uint32_t>::type
+        Find(const CONTENT& info) const
+        {
+            std::pair<typename Index::const_iterator, typename Index::const_iterator> range(_index.equal_range(info.Hash()));
 
-                // If we added the new time up front, retrigger the scheduler.
-                reevaluate = true;
-            } else if (index == _pendingQueue.end()) {
-                _pendingQueue.push_back(std::move(infoBlock));
-            } else {
-                _pendingQueue.insert(index, std::move(infoBlock));
+            uint32_t result = NotFound;
+
+            while ((range.first != range.second) && (range.first->second->Info != info)) {
+                ++range.first;
+            }
+            if (range.first != range.second) {
+                result = range.first->second->Position;
+            }
+
+            return (result);
+        }
+        template <typename SUBJECT = CONTENT>
+        inline typename Core::TypeTraits::enable_if<!hasHash<const SUBJECT, size_t>::value, uint32_t>::type
+        Find(const CONTENT& info) const
+        {
+            uint32_t result = NotFound;
+            uint32_t index = 0;
+            const uint32_t count = static_cast<uint32_t>(_heap.size());
+
+            while ((index < count) && (_heap[index]->Info != info)) {
+                ++index;
+            }
+            if (index < count) {
+                result = index;
             }
 
-            return (reevaluate);
+            return (result);
         }
 
     private:
-        SubscriberList _pendingQueue;
+        EntryList _entries;
+        Heap _heap;
+        Index _index;
+        uint64_t _sequence;
         TimeWorker _timerThread;
         mutable CriticalSection _adminLock;
         uint64_t _nextTrigger;
@@ -52,7 +52,7 @@ namespace Core {
                 ProxyType<IDispatch> job(ThreadPool::JobType<IMPLEMENTATION>::Submit());
 
                 if (job.IsValid()) {
-                    IWorkerPool::Instance().Submit(job);
+                    IWorkerPool::Instance().Submit(job, ThreadPool::JobType<IMPLEMENTATION>::Priority());
                 }
              
                 return (ThreadPool::JobType<IMPLEMENTATION>::IsIdle() == false);
@@ -75,7 +75,7 @@ namespace Core {
                     job = (ThreadPool::JobType<IMPLEMENTATION>::Idle());
 
                     if (job.IsValid() == true) {
-                        IWorkerPool::Instance().Schedule(time, job);
+                        IWorkerPool::Instance().Schedule(time, job, ThreadPool::JobType<IMPLEMENTATION>::Priority());
                     }
                 }
 
@@ -96,6 +96,7 @@ namespace Core {
             uint32_t Pending;
             uint8_t Slots;
             ThreadPool::Metadata* Slot;
+            ThreadPool::LaneMetadata Lane[ThreadPool::Priorities];
         };
 
         static void Assign(IWorkerPool* instance);
@@ -103,8 +104,8 @@ namespace Core {
         static bool IsAvailable();
 
         virtual ::ThreadId Id(const uint8_t index) const = 0;
-        virtual void Submit(const Core::ProxyType<IDispatch>& job) = 0;
-        virtual void Schedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job) = 0;
+        virtual void Submit(const Core::ProxyType<IDispatch>& job, const ThreadPool::priority lane = ThreadPool::NORMAL) = 0;
+        virtual void Schedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job, const ThreadPool::priority lane = ThreadPool::NORMAL) = 0;
         virtual bool Reschedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job) = 0;
         virtual uint32_t Revoke(const Core::ProxyType<IDispatch>& job, const uint32_t waitTime = Core::infinite) = 0;
         virtual void Join() = 0;
@@ -119,16 +120,19 @@ namespace Core {
             Timer()
                 : _job()
                 , _pool(nullptr)
+                , _lane(ThreadPool::NORMAL)
             {
             }
             Timer(const Timer& copy)
                 : _job(copy._job)
                 , _pool(copy._pool)
+                , _lane(copy._lane)
             {
             }
-            Timer(IWorkerPool* pool, const ProxyType<IDispatch>& job)
+            Timer(IWorkerPool* pool, const ProxyType<IDispatch>& job, const ThreadPool::priority lane = ThreadPool::NORMAL)
                 : _job(job)
                 , _pool(pool)
+                , _lane(lane)
             {
             }
             ~Timer()
@@ -144,10 +148,14 @@ namespace Core {
             {
                 return (!operator==(RHS));
             }
+            size_t Hash() const
+            {
+                return (_job.IsValid() == true ? reinterpret_cast<size_t>(_job.operator->()) : 0);
+            }
             uint64_t Timed(const uint64_t /* scheduledTime */)
             {
                 ASSERT(_pool != nullptr);
-                _pool->Submit(_job);
+                _pool->Submit(_job, _lane);
                 _job.Release();
 
                 // No need to reschedule, just drop it..
@@ -157,6 +165,7 @@ namespace Core {
         private:
             ProxyType<IDispatch> _job;
             IWorkerPool* _pool;
+            ThreadPool::priority _lane;
         };
         class Scheduler : public ThreadPool::IScheduler {
         public:
@@ -173,6 +182,9 @@ namespace Core {
             void Schedule(const Time& time, const ProxyType<IDispatch>& job) override {
                 _timer.Schedule(time, Timer(_pool, job));
             }
+            void Schedule(const Time& time, const ProxyType<IDispatch>& job, const ThreadPool::priority lane) override {
+                _timer.Schedule(time, Timer(_pool, job, lane));
+            }
 
         private:
             IWorkerPool* _pool;
@@ -331,23 +343,23 @@ POP_WARNING()
         }
 
     public:
-        void Submit(const Core::ProxyType<IDispatch>& job) override
+        void Submit(const Core::ProxyType<IDispatch>& job, const ThreadPool::priority lane = ThreadPool::NORMAL) override
         {
             // A job should always be submitted only once, see if te offered job does not reside in the _timer...
             ASSERT(_timer.HasEntry(Timer(this, job)) == false);
 
-            _threadPool.Submit(job, Core::infinite);
+            _threadPool.Submit(job, Core::infinite, lane);
         }
-        void Schedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job) override
+        void Schedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job, const ThreadPool::priority lane = ThreadPool::NORMAL) override
         {
             if (time > Core::Time::Now()) {
                 ASSERT(job.IsValid() == true);
                 ASSERT(_timer.HasEntry(Timer(this, job)) == false);
 
-                _timer.Schedule(time, Timer(this, job));
+                _timer.Schedule(time, Timer(this, job, lane));
             }
             else {
-                _threadPool.Submit(job, Core::infinite);
+                _threadPool.Submit(job, Core::infinite, lane);
             }
         }
         bool Reschedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job) override
@@ -401,6 +413,7 @@ POP_WARNING()
             _metadata.Slot[0].WorkerId = _joined;
 
             _threadPool.Info(_threadPool.Count(), &(_metadata.Slot[1]));
+            _threadPool.Lanes(ThreadPool::Priorities, _metadata.Lane);
 
             return (_metadata);
         }
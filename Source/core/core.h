@@ -56,6 +56,7 @@
 #include "IPCMessage.h"
 #include "IPCChannel.h"
 #include "IPCConnector.h"
+#include "IPCLane.h"
 #include "ISO639.h"
 #include "IPFrame.h"
 #include "JSON.h"
@@ -64,6 +65,7 @@
 #include "Library.h"
 #include "Link.h"
 #include "LockableContainer.h"
+#include "LockFreeQueue.h"
 #include "Measurement.h"
 #include "Media.h"
 #include "MessageException.h"
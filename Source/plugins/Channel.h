@@ -92,6 +92,7 @@ namespace PluginHost {
                 : _parent(parent)
                 , _current()
                 , _offset(0)
+                , _packed()
             {
             }
             ~SerializerImpl()
@@ -126,11 +127,49 @@ namespace PluginHost {
 
                 return (loaded);
             }
+            // MessagePack goes out in binary frames. The element is packed as a whole, the frames are cut from that.
+            uint16_t Pack(uint8_t* stream, const uint16_t length) const {
+                uint16_t loaded = 0;
+
+                if (_current.IsValid() == false) {
+                    _current = Core::ProxyType<const Core::JSON::IElement>(_parent.Element());
+
+                    if (_current.IsValid() == true) {
+                        const Core::JSON::IMessagePack* element = dynamic_cast<const Core::JSON::IMessagePack*>(&(*_current));
+
+                        _packed.clear();
+                        _offset = 0;
+
+                        if (element != nullptr) {
+                            Core::JSON::IMessagePack::ToBuffer(_packed, *element);
+                        } else {
+                            string text;
+                            _current->ToString(text);
+                            Core::JSON::MessagePack::FromText(text, _packed);
+                        }
+                    }
+                }
+
+                if (_current.IsValid() == true) {
+                    loaded = static_cast<uint16_t>(std::min(static_cast<size_t>(length), _packed.size() - _offset));
+                    ::memcpy(stream, &(_packed[_offset]), loaded);
+                    _offset += loaded;
+
+                    // A frame that is not full, ends the message.
+                    if (loaded != length) {
+                        _current.Release();
+                        _offset = 0;
+                    }
+                }
+
+                return (loaded);
+            }
 
         private:
             Channel& _parent;
             mutable Core::ProxyType<const Core::JSON::IElement> _current;
             mutable uint32_t _offset;
+            mutable std::vector<uint8_t> _packed;
         };
         class EXTERNAL DeserializerImpl {
         public:
@@ -142,6 +181,7 @@ namespace PluginHost {
                 : _parent(parent)
                 , _current()
                 , _offset(0)
+                , _packed()
             {
             }
             ~DeserializerImpl()
@@ -183,11 +223,42 @@ namespace PluginHost {
 
 				return (loaded);
             }
+            // MessagePack comes in binary frames, the element is unpacked once the message is complete.
+            uint16_t Unpack(const uint8_t* stream, const uint16_t length, const bool completed)
+            {
+                _packed.insert(_packed.end(), stream, stream + length);
+
+                if (completed == true) {
+                    if (_parent.IsOpen() == true) {
+                        _current = _parent.Element(EMPTY_STRING);
+                    }
+
+                    if (_current.IsValid() == true) {
+                        Core::JSON::IMessagePack* element = dynamic_cast<Core::JSON::IMessagePack*>(&(*_current));
+
+                        if (element != nullptr) {
+                            Core::JSON::IMessagePack::FromBuffer(_packed, *element);
+                        } else {
+                            string text;
+                            Core::JSON::MessagePack::ToText(_packed.data(), static_cast<uint32_t>(_packed.size()), text);
+                            _current->FromString(text);
+                        }
+
+                        _parent.Received(_current);
+                        _current.Release();
+                    }
+
+                    _packed.clear();
+                }
+
+                return (length);
+            }
 
         private:
             Channel& _parent;
             Core::ProxyType<Core::JSON::IElement> _current;
             uint32_t _offset;
+            std::vector<uint8_t> _packed;
         };
 
     public:
@@ -198,6 +269,7 @@ namespace PluginHost {
             RAW = 0x08,
             TEXT = 0x10,
             JSONRPC = 0x20,
+            MESSAGEPACK = 0x2000,
             PINGED = 0x4000,
             NOTIFIED = 0x8000
         };
@@ -258,6 +330,10 @@ namespace PluginHost {
         {
             return ((_state & NOTIFIED) != 0);
         }
+        bool IsMessagePack() const
+        {
+            return ((_state & MESSAGEPACK) != 0);
+        }
         void Submit(const string& text)
         {
             if (IsOpen() == true) {
@@ -322,9 +398,20 @@ namespace PluginHost {
         {
             BaseClass::Lock();
 
-            Binary(state == RAW);
+            Binary((state == RAW) || ((_state & MESSAGEPACK) != 0));
+
+            _state = state | (notification ? NOTIFIED : 0x0000) | (_state & MESSAGEPACK);
+
+            BaseClass::Unlock();
+        }
+        // The JSON (or JSON-RPC) elements travel as MessagePack, in binary frames.
+        void MessagePack(const bool enabled)
+        {
+            BaseClass::Lock();
+
+            _state = (enabled ? (_state | MESSAGEPACK) : (_state & (~MESSAGEPACK)));
 
-            _state = state | (notification ? NOTIFIED : 0x0000);
+            Binary(((_state & 0x0FFF) == RAW) || (enabled == true));
 
             BaseClass::Unlock();
         }
@@ -336,7 +423,11 @@ namespace PluginHost {
             case JSON:
             case JSONRPC: {
                 // Seems we are sending JSON structs
-                size = _serializer.Serialize(reinterpret_cast<char*>(dataFrame), maxSendSize);
+                if (IsMessagePack() == true) {
+                    size = _serializer.Pack(dataFrame, maxSendSize);
+                } else {
+                    size = _serializer.Serialize(reinterpret_cast<char*>(dataFrame), maxSendSize);
+                }
 
                 if (_serializer.IsIdle() == false) {
                     ASSERT(size != 0);
@@ -413,7 +504,11 @@ namespace PluginHost {
             switch (State()) {
             case JSON:
             case JSONRPC: {
-                handled = _deserializer.Deserialize(reinterpret_cast<const char*>(dataFrame), receivedSize);
+                if (IsMessagePack() == true) {
+                    handled = _deserializer.Unpack(dataFrame, receivedSize, BaseClass::IsCompleted());
+                } else {
+                    handled = _deserializer.Deserialize(reinterpret_cast<const char*>(dataFrame), receivedSize);
+                }
                 break;
             }
             case TEXT: {
@@ -23,6 +23,8 @@ namespace WPEFramework {
 
 namespace PluginHost {
 
+    /* static */ Core::ProxyPoolType<Core::JSONRPC::Notification> JSONRPC::_notificationFactory(2);
+
     JSONRPC::JSONRPC()
         : _adminLock()
         , _handlers()
@@ -32,7 +34,7 @@ namespace PluginHost {
     {
         std::vector<uint8_t> versions = { 1 };
 
-        _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+        _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body) { Notify(id, designator, body); }, versions);
     }
 
     JSONRPC::JSONRPC(const std::vector<uint8_t>& versions)
@@ -42,7 +44,7 @@ namespace PluginHost {
         , _callsign()
         , _validate()
     {
-        _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+        _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body) { Notify(id, designator, body); }, versions);
     }
 
     JSONRPC::JSONRPC(const TokenCheckFunction& validation)
@@ -54,7 +56,7 @@ namespace PluginHost {
     {
         std::vector<uint8_t> versions = { 1 };
 
-        _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+        _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body) { Notify(id, designator, body); }, versions);
     }
 
     JSONRPC::JSONRPC(const std::vector<uint8_t>& versions, const TokenCheckFunction& validation)
@@ -64,7 +66,7 @@ namespace PluginHost {
         , _callsign()
         , _validate(validation)
     {
-        _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+        _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body) { Notify(id, designator, body); }, versions);
     }
 
     /* virtual */ JSONRPC::~JSONRPC()
@@ -161,12 +161,12 @@ namespace PluginHost {
         }
         Core::JSONRPC::Handler& CreateHandler(const std::vector<uint8_t>& versions)
         {
-            _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions);
+            _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body) { Notify(id, designator, body); }, versions);
             return (_handlers.back());
         }
         Core::JSONRPC::Handler& CreateHandler(const std::vector<uint8_t>& versions, const Core::JSONRPC::Handler& source)
         {
-            _handlers.emplace_back([&](const uint32_t id, const string& designator, const string& data) { Notify(id, designator, data); }, versions, source);
+            _handlers.emplace_back([&](const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body) { Notify(id, designator, body); }, versions, source);
             return (_handlers.back());
         }
         Core::JSONRPC::Handler* GetHandler(uint8_t version)
@@ -265,15 +265,19 @@ namespace PluginHost {
         {
             string subject;
             parameters.ToString(subject);
-            return (Response(channel, subject));
+            return (Response(channel, std::move(subject)));
         }
         uint32_t Response(const Core::JSONRPC::Context& channel, const string& result)
+        {
+            return (Response(channel, string(result)));
+        }
+        uint32_t Response(const Core::JSONRPC::Context& channel, string&& result)
         {
             Core::ProxyType<Web::JSONBodyType<Core::JSONRPC::Message>> message = IFactories::Instance().JSONRPC();
 
             ASSERT(_service != nullptr);
 
-            message->Result = result;
+            message->Result = std::move(result);
             message->Id = channel.Sequence();
             message->JSONRPC = Core::JSONRPC::Message::DefaultVersion;
 
@@ -312,13 +316,15 @@ namespace PluginHost {
             Core::ProxyType<Core::JSONRPC::Message> response(Message());
             Core::JSONRPC::Handler* source = nullptr;
             string method(inbound.Designator.Value());
+            string storage;
+            const string& parameters(inbound.Params(storage));
 
             if (inbound.Id.IsSet() == true) {
                 response->JSONRPC = Core::JSONRPC::Message::DefaultVersion;
                 response->Id = inbound.Id.Value();
             }
 
-            if ((_validate != nullptr) && ( (result = _validate(context.Token(), Core::JSONRPC::Message::Method(method), inbound.Parameters.Value())) == classification::INVALID)) {
+            if ((_validate != nullptr) && ( (result = _validate(context.Token(), Core::JSONRPC::Message::Method(method), parameters)) == classification::INVALID)) {
                 response->Error.SetError(Core::ERROR_PRIVILIGED_REQUEST);
                 response->Error.Text = _T("method invokation not allowed.");
             } 
@@ -341,15 +347,15 @@ namespace PluginHost {
                     response->Error.Text = _T("Unknown method.");
                     break;
                 case STATE_REGISTRATION:
-                    info.FromString(inbound.Parameters.Value());
+                    info.FromString(parameters);
                     Subscribe(*source, context.ChannelId(), info.Event.Value(), info.Callsign.Value(), *response);
                     break;
                 case STATE_UNREGISTRATION:
-                    info.FromString(inbound.Parameters.Value());
+                    info.FromString(parameters);
                     Unsubscribe(*source, context.ChannelId(), info.Event.Value(), info.Callsign.Value(), *response);
                     break;
                 case STATE_EXISTS:
-                    if (Exists(*source, inbound.Parameters.Value()) == true) {
+                    if (Exists(*source, parameters) == true) {
                         response->Result = Core::NumberType<uint32_t>(Core::ERROR_NONE).Text();
                     } else {
                         response->Result = Core::NumberType<uint32_t>(Core::ERROR_UNKNOWN_KEY).Text();
@@ -357,7 +363,7 @@ namespace PluginHost {
                     break;
                 case STATE_CUSTOM:
                     string result;
-                    uint32_t code = source->Invoke(context, inbound.FullMethod(), inbound.Parameters.Value(), result);
+                    uint32_t code = source->Invoke(context, inbound.FullMethod(), parameters, result);
                     if (response.IsValid() == true) {
                         if (code == static_cast<uint32_t>(~0)) {
                             response.Release();
@@ -365,7 +371,7 @@ namespace PluginHost {
                             if (result.empty() == true) {
                                 response->Result.Null(true);
                             } else {
-                                response->Result = result;
+                                response->Result = std::move(result);
                             }
                         } else {
                             response->Error.Code = code;
@@ -435,6 +441,16 @@ namespace PluginHost {
 
             _service->Submit(id, Core::ProxyType<Core::JSON::IElement>(message));
         }
+        void Notify(const uint32_t id, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body)
+        {
+            Core::ProxyType<Core::JSONRPC::Notification> message(_notificationFactory.Element());
+
+            ASSERT(_service != nullptr);
+
+            message->Set(designator, body);
+
+            _service->Submit(id, Core::ProxyType<Core::JSON::IElement>(message));
+        }
         void Activate(IShell* service) override
         {
             ASSERT(_service == nullptr);
@@ -471,6 +487,8 @@ namespace PluginHost {
         string _callsign;
         TokenCheckFunction _validate;
         VersionList _versions;
+
+        static Core::ProxyPoolType<Core::JSONRPC::Notification> _notificationFactory;
     };
 
     class EXTERNAL JSONRPCSupportsEventStatus : public JSONRPC {
@@ -55,6 +55,14 @@ ENUM_CONVERSION_BEGIN(PluginHost::MetaData::Channel::state)
 
     ENUM_CONVERSION_END(PluginHost::ISubSystem::IInternet::network_type)
 
+    ENUM_CONVERSION_BEGIN(Core::ThreadPool::priority)
+
+    { Core::ThreadPool::CRITICAL, _TXT("critical") },
+    { Core::ThreadPool::NORMAL, _TXT("normal") },
+    { Core::ThreadPool::BULK, _TXT("bulk") },
+
+    ENUM_CONVERSION_END(Core::ThreadPool::priority)
+
 namespace PluginHost
 {
 
@@ -121,6 +129,8 @@ namespace PluginHost
 #if THUNDER_RESTFULL_API
         , Observers(0)
 #endif
+        , Executing(0)
+        , Queued(0)
         , Module()
         , Hash()
         , Major(0)
@@ -136,6 +146,8 @@ namespace PluginHost
 #if THUNDER_RESTFULL_API
         Add(_T("observers"), &Observers);
 #endif
+        Add(_T("executing"), &Executing);
+        Add(_T("queued"), &Queued);
         Add(_T("module"), &Module);
         Add(_T("hash"), &Hash);
         Add(_T("major"), &Major);
@@ -153,6 +165,8 @@ namespace PluginHost
 #if THUNDER_RESTFULL_API
         , Observers(copy.Observers)
 #endif
+        , Executing(copy.Executing)
+        , Queued(copy.Queued)
         , Module(copy.Module)
         , Hash(copy.Hash)
         , Major(copy.Major)
@@ -168,6 +182,8 @@ namespace PluginHost
 #if THUNDER_RESTFULL_API
         Add(_T("observers"), &Observers);
 #endif
+        Add(_T("executing"), &Executing);
+        Add(_T("queued"), &Queued);
         Add(_T("module"), &Module);
         Add(_T("hash"), &Hash);
         Add(_T("major"), &Major);
@@ -294,10 +310,50 @@ namespace PluginHost
     MetaData::Server::Minion::~Minion() {
     }
 
+    MetaData::Server::Lane::Lane()
+        : Core::JSON::Container()
+        , Priority(Core::ThreadPool::NORMAL)
+        , Pending(0)
+        , Dispatched(0)
+        , AverageWait(0)
+        , MaximumWait(0) {
+        Add(_T("priority"), &Priority);
+        Add(_T("pending"), &Pending);
+        Add(_T("dispatched"), &Dispatched);
+        Add(_T("averagewait"), &AverageWait);
+        Add(_T("maximumwait"), &MaximumWait);
+    }
+    MetaData::Server::Lane& MetaData::Server::Lane::operator=(const Core::ThreadPool::LaneMetadata& info) {
+        Priority = info.Lane;
+        Pending = info.Pending;
+        Dispatched = info.Dispatched;
+        AverageWait = info.AverageWait;
+        MaximumWait = info.MaximumWait;
+        return (*this);
+    }
+    MetaData::Server::Lane::Lane(const Lane& copy)
+        : Core::JSON::Container()
+        , Priority(copy.Priority)
+        , Pending(copy.Pending)
+        , Dispatched(copy.Dispatched)
+        , AverageWait(copy.AverageWait)
+        , MaximumWait(copy.MaximumWait) {
+        Add(_T("priority"), &Priority);
+        Add(_T("pending"), &Pending);
+        Add(_T("dispatched"), &Dispatched);
+        Add(_T("averagewait"), &AverageWait);
+        Add(_T("maximumwait"), &MaximumWait);
+    }
+    MetaData::Server::Lane::~Lane() {
+    }
+
     MetaData::Server::Server()
     {
         Core::JSON::Container::Add(_T("threads"), &ThreadPoolRuns);
         Core::JSON::Container::Add(_T("pending"), &PendingRequests);
+        Core::JSON::Container::Add(_T("lanes"), &Lanes);
+        Core::JSON::Container::Add(_T("tokenhits"), &TokenHits);
+        Core::JSON::Container::Add(_T("tokenmisses"), &TokenMisses);
     }
     MetaData::Server::~Server()
     {
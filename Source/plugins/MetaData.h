@@ -88,6 +88,8 @@ namespace PluginHost {
 #if THUNDER_RESTFULL_API
             Core::JSON::DecUInt32 Observers;
 #endif
+            Core::JSON::DecUInt32 Executing;
+            Core::JSON::DecUInt32 Queued;
             Core::JSON::String Module;
             Core::JSON::String Hash;
             Core::JSON::DecUInt8 Major;
@@ -175,6 +177,24 @@ namespace PluginHost {
                 Core::JSON::DecUInt32 Runs;
             };
 
+            class EXTERNAL Lane : public Core::JSON::Container {
+            public:
+                Lane& operator=(const Lane&) = delete;
+
+                Lane();
+                Lane(const Lane& copy);
+                ~Lane();
+
+                Lane& operator= (const Core::ThreadPool::LaneMetadata&);
+
+            public:
+                Core::JSON::EnumType<Core::ThreadPool::priority> Priority;
+                Core::JSON::DecUInt32 Pending;
+                Core::JSON::DecUInt32 Dispatched;
+                Core::JSON::DecUInt32 AverageWait;
+                Core::JSON::DecUInt32 MaximumWait;
+            };
+
         public:
             Server(const Server& copy) = delete;
             Server& operator=(const Server&) = delete;
@@ -185,11 +205,15 @@ namespace PluginHost {
             inline void Clear()
             {
                 ThreadPoolRuns.Clear();
+                Lanes.Clear();
             }
 
         public:
             Core::JSON::ArrayType<Minion> ThreadPoolRuns;
             Core::JSON::DecUInt32 PendingRequests;
+            Core::JSON::ArrayType<Lane> Lanes;
+            Core::JSON::DecUInt32 TokenHits;
+            Core::JSON::DecUInt32 TokenMisses;
         };
 
         class EXTERNAL SubSystem : public Core::JSON::Container {
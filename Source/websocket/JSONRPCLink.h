@@ -69,6 +69,10 @@ namespace WPEFramework {
 						{
 							return (!operator==(rhs));
 						}
+						size_t Hash() const
+						{
+							return (reinterpret_cast<size_t>(_client));
+						}
 
 					public:
 						uint64_t Timed(const uint64_t scheduledTime) {
@@ -126,9 +130,12 @@ namespace WPEFramework {
 
 					typedef Core::StreamJSONType<Web::WebSocketClientType<Core::SocketStream>, FactoryImpl&, INTERFACE> BaseClass;
 
+					// MessagePack messages travel in binary frames, over the subprotocol that says so.
+					static constexpr bool IsPacked = std::is_same<INTERFACE, Core::JSON::IMessagePack>::value;
+
 				public:
 					ChannelImpl(CommunicationChannel* parent, const Core::NodeId& remoteNode, const string& callsign, const string& query)
-						: BaseClass(5, FactoryImpl::Instance(), callsign, _T("JSON"), query, "", false, false, false, remoteNode.AnyInterface(), remoteNode, 256, 256)
+						: BaseClass(5, FactoryImpl::Instance(), callsign, (IsPacked ? _T("jsonrpc.msgpack") : _T("JSON")), query, "", IsPacked, false, false, remoteNode.AnyInterface(), remoteNode, 256, 256)
 						, _parent(*parent)
 					{
 					}
@@ -456,7 +463,7 @@ namespace WPEFramework {
 				: _adminLock()
 				, _connectId(RemoteNodeId())
 				, _channel(CommunicationChannel::Instance(_connectId, string("/jsonrpc/") + connectingCallsign, query))
-				, _handler([&](const uint32_t, const string&, const string&) {}, { DetermineVersion(callsign) })
+				, _handler([&](const uint32_t, const string&, const Core::ProxyType<Core::JSONRPC::Notification::Body>&) {}, { DetermineVersion(callsign) })
 				, _callsign(callsign.empty() ? string() : Core::JSONRPC::Message::Callsign(callsign + '.'))
 				, _localSpace()
 				, _pendingQueue()
@@ -1073,7 +1080,7 @@ namespace WPEFramework {
 						ASSERT(inbound->Id.IsSet() == false);
 
 						string response;
-						_handler.Invoke(Core::JSONRPC::Context(), inbound->FullMethod(), inbound->Parameters.Value(), response);
+						_handler.Invoke(Core::JSONRPC::Context(), *inbound, response);
 					}
 				}
 
@@ -1095,11 +1102,13 @@ namespace WPEFramework {
 			}
 			void ToMessage(Core::JSON::IMessagePack* parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
 			{
+				// The message keeps the parameters as text, they are packed again as part of the message.
 				std::vector<uint8_t> values;
 				parameters->ToBuffer(values);
 				if (values.empty() != true) {
-					string strValues(values.begin(), values.end());
-					message->Parameters = strValues;
+					string text;
+					Core::JSON::MessagePack::ToText(values.data(), static_cast<uint32_t>(values.size()), text);
+					message->Parameters = text;
 				}
 				return;
 			}
@@ -1118,8 +1127,8 @@ namespace WPEFramework {
 			}
 			void FromMessage(Core::JSON::IMessagePack* response, const Core::JSONRPC::Message& message)
 			{
-				string value = message.Result.Value();
-				std::vector<uint8_t> result(value.begin(), value.end());
+				std::vector<uint8_t> result;
+				Core::JSON::MessagePack::FromText(message.Result.Value(), result);
 				response->FromBuffer(result);
 			}
 
@@ -95,6 +95,7 @@ namespace Web {
             ALLOW,
             WEBSOCKET_ACCEPT,
             WEBSOCKET_PROTOCOL,
+            WEBSOCKET_EXTENSIONS,
             LOCATION,
             WAKEUP,
             U_S_N,
@@ -392,6 +393,7 @@ POP_WARNING()
             ContentLength.Clear();
             ContentEncoding.Clear();
             WebSocketAccept.Clear();
+            WebSocketExtensions.Clear();
             AccessControlOrigin.Clear();
             AccessControlMethod.Clear();
             AccessControlHeaders.Clear();
@@ -440,6 +442,7 @@ POP_WARNING()
         Core::OptionalType<string> WakeUp;
         Core::OptionalType<string> ETag;
         Core::OptionalType<string> WebSocketProtocol;
+        Core::OptionalType<string> WebSocketExtensions;
         Core::OptionalType<string> CacheControl;
         Core::OptionalType<Core::URL> ApplicationURL;
 
@@ -228,6 +228,7 @@ ENUM_CONVERSION_BEGIN(Web::Request::keywords)
     { Web::Request::WEBSOCKET_KEY, __TXT(__WEBSOCKET_KEY) },
     { Web::Request::WEBSOCKET_PROTOCOL, __TXT(__WEBSOCKET_PROTOCOL) },
     { Web::Request::WEBSOCKET_VERSION, __TXT(__WEBSOCKET_VERSION) },
+    { Web::Request::WEBSOCKET_EXTENSIONS, __TXT(__WEBSOCKET_EXTENSIONS) },
     { Web::Request::MAN, __TXT(__MAN) },
     { Web::Request::M_X, __TXT(__MX) },
     { Web::Request::S_T, __TXT(__ST) },
@@ -272,6 +273,7 @@ ENUM_CONVERSION_BEGIN(Web::Response::keywords)
     { Web::Response::ACCESS_CONTROL_MAX_AGE, __TXT(__ACCESS_CONTROL_MAX_AGE) },
     { Web::Response::WEBSOCKET_ACCEPT, __TXT(__WEBSOCKET_ACCEPT) },
     { Web::Response::WEBSOCKET_PROTOCOL, __TXT(__WEBSOCKET_PROTOCOL) },
+    { Web::Response::WEBSOCKET_EXTENSIONS, __TXT(__WEBSOCKET_EXTENSIONS) },
     { Web::Response::LOCATION, __TXT(__LOCATION) },
     { Web::Response::WAKEUP, __TXT(__WAKEUP) },
     { Web::Response::U_S_N, __TXT(__USN) },
@@ -1084,8 +1086,13 @@ namespace Web
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WEBSOCKET_PROTOCOL : _T("Sec-WebSocket-Protocol:"));
                             _value = _current->WebSocketProtocol.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 9) && (_current->Allowed.IsSet() == true)) {
+                        } else if ((_keyIndex <= 9) && (_current->WebSocketExtensions.IsSet() == true)) {
                             _keyIndex = 10;
+                            _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WEBSOCKET_EXTENSIONS : _T("Sec-WebSocket-Extensions:"));
+                            _value = _current->WebSocketExtensions.Value();
+                            _offset = 0;
+                        } else if ((_keyIndex <= 10) && (_current->Allowed.IsSet() == true)) {
+                            _keyIndex = 11;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ALLOW : _T("Allow:"));
                             _value = _T("");
                             _offset = 0;
@@ -1104,18 +1111,18 @@ namespace Web
                                 }
                                 entry = Core::EnumerateType<Request::type>::Entry(++index);
                             }
-                        } else if ((_keyIndex <= 10) && (_current->AccessControlHeaders.IsSet() == true)) {
-                            _keyIndex = 11;
+                        } else if ((_keyIndex <= 11) && (_current->AccessControlHeaders.IsSet() == true)) {
+                            _keyIndex = 12;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_HEADERS : _T("Access-Control-Allow-Headers:"));
                             _value = _current->AccessControlHeaders.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 11) && (_current->AccessControlOrigin.IsSet() == true)) {
-                            _keyIndex = 12;
+                        } else if ((_keyIndex <= 12) && (_current->AccessControlOrigin.IsSet() == true)) {
+                            _keyIndex = 13;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_ORIGIN : _T("Access-Control-Allow-Origin:"));
                             _value = _current->AccessControlOrigin.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 12) && (_current->AccessControlMethod.IsSet() == true)) {
-                            _keyIndex = 13;
+                        } else if ((_keyIndex <= 13) && (_current->AccessControlMethod.IsSet() == true)) {
+                            _keyIndex = 14;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_ALLOW_METHODS : _T("Access-Control-Allow-Methods:"));
                             _value = _T("");
                             _offset = 0;
@@ -1134,17 +1141,17 @@ namespace Web
                                 }
                                 entry = Core::EnumerateType<Request::type>::Entry(++index);
                             }
-                        } else if ((_keyIndex <= 13) && (_current->AccessControlMaxAge.IsSet() == true)) {
-                            _keyIndex = 14;
+                        } else if ((_keyIndex <= 14) && (_current->AccessControlMaxAge.IsSet() == true)) {
+                            _keyIndex = 15;
 
                             Core::NumberType<uint32_t, false, BASE_DECIMAL> number(_current->AccessControlMaxAge.Value());
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ACCESS_CONTROL_MAX_AGE : _T("Access-Control-Max-Age:"));
                             number.Serialize(_value);
                             _offset = 0;
-                        } else if ((_keyIndex <= 14) && (_current->ContentType.IsSet() == true)) {
+                        } else if ((_keyIndex <= 15) && (_current->ContentType.IsSet() == true)) {
                             Core::EnumerateType<MIMETypes> enumValue(_current->ContentType.Value());
 
-                            _keyIndex = 15;
+                            _keyIndex = 16;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_TYPE : _T("Content-Type:"));
                             _value = enumValue.Data();
                             if (_current->ContentCharacterSet.IsSet() == true) {
@@ -1154,59 +1161,59 @@ namespace Web
                             }
 
                             _offset = 0;
-                        } else if ((_keyIndex <= 15) && (_current->ContentEncoding.IsSet() == true)) {
+                        } else if ((_keyIndex <= 16) && (_current->ContentEncoding.IsSet() == true)) {
                             Core::EnumerateType<EncodingTypes> enumValue(_current->ContentEncoding.Value());
 
-                            _keyIndex = 16;
+                            _keyIndex = 17;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_ENCODING : _T("Content-Encoding:"));
                             _value = enumValue.Data();
                             _offset = 0;
-                        } else if ((_keyIndex <= 16) && (_current->TransferEncoding.IsSet() == true)) {
+                        } else if ((_keyIndex <= 17) && (_current->TransferEncoding.IsSet() == true)) {
                             Core::EnumerateType<TransferTypes> enumValue(_current->TransferEncoding.Value());
 
-                            _keyIndex = 17;
+                            _keyIndex = 18;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __TRANSFER_ENCODING : _T("Transfer-Encoding:"));
                             _value = enumValue.Data();
                             _offset = 0;
-                        } else if ((_keyIndex <= 17) && (_current->Location.IsSet() == true)) {
-                            _keyIndex = 18;
+                        } else if ((_keyIndex <= 18) && (_current->Location.IsSet() == true)) {
+                            _keyIndex = 19;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __LOCATION : _T("Location:"));
                             _value = _current->Location.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 18) && (_current->WakeUp.IsSet() == true)) {
-                            _keyIndex = 19;
+                        } else if ((_keyIndex <= 19) && (_current->WakeUp.IsSet() == true)) {
+                            _keyIndex = 20;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __WAKEUP : _T("Wakeup:"));
                             _value = _current->WakeUp.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 19) && (_current->USN.IsSet() == true)) {
-                            _keyIndex = 20;
+                        } else if ((_keyIndex <= 20) && (_current->USN.IsSet() == true)) {
+                            _keyIndex = 21;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __USN : _T("USN:"));
                             _value = _current->USN.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 20) && (_current->ST.IsSet() == true)) {
-                            _keyIndex = 21;
+                        } else if ((_keyIndex <= 21) && (_current->ST.IsSet() == true)) {
+                            _keyIndex = 22;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __ST : _T("ST:"));
                             _value = _current->ST.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 21) && (_current->CacheControl.IsSet() == true)) {
-                            _keyIndex = 22;
+                        } else if ((_keyIndex <= 22) && (_current->CacheControl.IsSet() == true)) {
+                            _keyIndex = 23;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CACHE_CONTROL : _T("Cache-Control:"));
                             _value = _current->CacheControl.Value();
                             _offset = 0;
-                        } else if ((_keyIndex <= 22) && (_current->ApplicationURL.IsSet() == true)) {
-                            _keyIndex = 23;
+                        } else if ((_keyIndex <= 23) && (_current->ApplicationURL.IsSet() == true)) {
+                            _keyIndex = 24;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __APPLICATION_URL : _T("Application-URL:"));
                             _value = _current->ApplicationURL.Value().Text();
                             _offset = 0;
-                        } else if ((_keyIndex <= 23) && (((_bodyLength = (_current->_body.IsValid() ? _current->_body->Serialize() : 0)) > 0) || (_current->ContentLength.IsSet() == true) || (!_current->Connection.IsSet()) || (_current->Connection.Value() != Response::CONNECTION_CLOSE))) {
-                            _keyIndex = (_bodyLength > 0 ? 24 : 25);
+                        } else if ((_keyIndex <= 24) && (((_bodyLength = (_current->_body.IsValid() ? _current->_body->Serialize() : 0)) > 0) || (_current->ContentLength.IsSet() == true) || (!_current->Connection.IsSet()) || (_current->Connection.Value() != Response::CONNECTION_CLOSE))) {
+                            _keyIndex = (_bodyLength > 0 ? 25 : 26);
 
                             Core::NumberType<uint32_t, false, BASE_DECIMAL> number(_bodyLength);
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_LENGTH : _T("Content-Length:"));
                             number.Serialize(_value);
                             _offset = 0;
-                        } else if ((_keyIndex <= 24) && (_current->ContentSignature.IsSet() == true)) {
-                            _keyIndex = 25;
+                        } else if ((_keyIndex <= 25) && (_current->ContentSignature.IsSet() == true)) {
+                            _keyIndex = 26;
                             _buffer = (_current->Mode() == MARSHAL_UPPERCASE ? __CONTENT_SIGNATURE : _T("Content-HMAC:"));
                             FromSignature(_current->ContentSignature.Value(), _value);
                             _offset = 0;
@@ -1849,6 +1856,9 @@ namespace Web
             case Response::WEBSOCKET_PROTOCOL:
                 _current->WebSocketProtocol = buffer;
                 break;
+            case Response::WEBSOCKET_EXTENSIONS:
+                _current->WebSocketExtensions = buffer;
+                break;
             case Response::CONTENT_SIGNATURE:
                 _current->ContentSignature = ToSignature(buffer);
                 break;
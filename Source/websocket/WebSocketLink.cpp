@@ -19,6 +19,12 @@
 
 #include "WebSocketLink.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace WPEFramework {
 namespace Web {
     namespace WebSocket {
@@ -35,11 +41,391 @@ namespace Web {
             return (_responseAllocator);
         }
 
+        static const TCHAR PerMessageDeflate[] = _T("permessage-deflate");
+        static const uint8_t DeflateTail[] = { 0x00, 0x00, 0xFF, 0xFF };
+
+        static string Trim(const string& text)
+        {
+            const size_t start = text.find_first_not_of(_T(" \t"));
+
+            return (start == string::npos ? string() : text.substr(start, text.find_last_not_of(_T(" \t")) - start + 1));
+        }
+
+        static std::vector<string> Split(const string& text, const TCHAR delimiter)
+        {
+            std::vector<string> result;
+            size_t start = 0;
+            size_t end;
+
+            while ((end = text.find(delimiter, start)) != string::npos) {
+                result.push_back(Trim(text.substr(start, end - start)));
+                start = end + 1;
+            }
+            result.push_back(Trim(text.substr(start)));
+
+            return (result);
+        }
+
+        // The parameters of an extension: key[=value], the value might be quoted.
+        static void Parameter(const string& text, string& key, string& value)
+        {
+            const size_t equal = text.find('=');
+
+            if (equal == string::npos) {
+                key = text;
+                value.clear();
+            } else {
+                key = Trim(text.substr(0, equal));
+                value = Trim(text.substr(equal + 1));
+
+                if ((value.length() >= 2) && (value[0] == '"') && (value[value.length() - 1] == '"')) {
+                    value = value.substr(1, value.length() - 2);
+                }
+            }
+        }
+
+        // Window bits are 8..15, no value at all is reported as 0 and anything else as 0xFF.
+        static uint8_t WindowBits(const string& value)
+        {
+            uint8_t result = (value.empty() == true ? 0 : 0xFF);
+
+            if ((value.length() <= 2) && (value.find_first_not_of(_T("0123456789")) == string::npos) && (value.empty() == false)) {
+                const uint8_t bits = static_cast<uint8_t>(::atoi(value.c_str()));
+
+                if ((bits >= 8) && (bits <= 15)) {
+                    result = bits;
+                }
+            }
+
+            return (result);
+        }
+
+        Deflate::Deflate()
+            : _settings()
+            , _configured(false)
+            , _active(false)
+            , _windowBits(15)
+            , _peerWindowBits(15)
+            , _contextTakeover(true)
+            , _deflaterReady(false)
+            , _inflaterReady(false)
+            , _dropping(false)
+            , _receiving(false)
+            , _state(IDLE)
+            , _deflater()
+            , _inflater()
+            , _plain()
+            , _pending()
+            , _offset(0)
+            , _message()
+        {
+            ::memset(&_statistics, 0, sizeof(_statistics));
+        }
+
+        Deflate::~Deflate()
+        {
+            Reset();
+        }
+
+        void Deflate::Configure(const Settings& settings)
+        {
+            _settings = settings;
+
+            // zlib can not deflate a raw stream with a window of 8 bits.
+            _settings.WindowBits = std::max(std::min(_settings.WindowBits, static_cast<uint8_t>(15)), static_cast<uint8_t>(9));
+            _settings.PeerWindowBits = std::max(std::min(_settings.PeerWindowBits, static_cast<uint8_t>(15)), static_cast<uint8_t>(9));
+            _settings.MemoryLevel = std::max(std::min(_settings.MemoryLevel, static_cast<uint8_t>(9)), static_cast<uint8_t>(1));
+            _configured = true;
+        }
+
+        void Deflate::Reset()
+        {
+            if (_deflaterReady == true) {
+                deflateEnd(&_deflater);
+                _deflaterReady = false;
+            }
+            if (_inflaterReady == true) {
+                inflateEnd(&_inflater);
+                _inflaterReady = false;
+            }
+
+            _active = false;
+            _dropping = false;
+            _receiving = false;
+            _state = IDLE;
+            _pending.clear();
+            _offset = 0;
+            _message.clear();
+        }
+
+        string Deflate::Offer() const
+        {
+            string result(PerMessageDeflate);
+
+            result += _T("; client_max_window_bits");
+
+            if (_settings.WindowBits < 15) {
+                result += '=' + Core::NumberType<uint8_t>(_settings.WindowBits).Text();
+            }
+            if (_settings.ContextTakeover == false) {
+                result += _T("; client_no_context_takeover");
+            }
+            if (_settings.PeerContextTakeover == false) {
+                result += _T("; server_no_context_takeover");
+            }
+            if (_settings.PeerWindowBits < 15) {
+                result += _T("; server_max_window_bits=") + Core::NumberType<uint8_t>(_settings.PeerWindowBits).Text();
+            }
+
+            return (result);
+        }
+
+        bool Deflate::Agree(const string& response)
+        {
+            std::vector<string> parameters(Split(response, ';'));
+            bool result = ((_configured == true) && (parameters[0] == PerMessageDeflate) && (response.find(',') == string::npos));
+
+            Reset();
+
+            _windowBits = _settings.WindowBits;
+            _peerWindowBits = 15;
+            _contextTakeover = _settings.ContextTakeover;
+
+            for (uint8_t index = 1; (result == true) && (index < parameters.size()); index++) {
+                string key, value;
+
+                Parameter(parameters[index], key, value);
+
+                if (key == _T("server_no_context_takeover")) {
+                    result = value.empty();
+                } else if (key == _T("client_no_context_takeover")) {
+                    result = value.empty();
+                    _contextTakeover = false;
+                } else if (key == _T("server_max_window_bits")) {
+                    const uint8_t bits = WindowBits(value);
+                    result = ((bits != 0) && (bits <= 15));
+                    _peerWindowBits = bits;
+                } else if (key == _T("client_max_window_bits")) {
+                    const uint8_t bits = WindowBits(value);
+                    result = ((bits != 0) && (bits <= 15));
+                    // A window we can not deflate with, means we send the messages as they are.
+                    _windowBits = (bits < 9 ? 0 : std::min(_windowBits, bits));
+                } else {
+                    result = false;
+                }
+            }
+
+            _active = result;
+
+            return (result);
+        }
+
+        bool Deflate::Accept(const string& offers, string& response)
+        {
+            Reset();
+
+            response.clear();
+
+            if (_configured == true) {
+                std::vector<string> list(Split(offers, ','));
+
+                for (uint8_t offer = 0; (_active == false) && (offer < list.size()); offer++) {
+                    std::vector<string> parameters(Split(list[offer], ';'));
+
+                    if (parameters[0] == PerMessageDeflate) {
+                        bool valid = true;
+                        bool serverTakeover = true;
+                        bool clientTakeover = true;
+                        uint8_t serverBits = 0;
+                        uint8_t clientBits = 0;
+                        bool clientWindow = false;
+
+                        for (uint8_t index = 1; (valid == true) && (index < parameters.size()); index++) {
+                            string key, value;
+
+                            Parameter(parameters[index], key, value);
+
+                            if ((key == _T("server_no_context_takeover")) && (value.empty() == true) && (serverTakeover == true)) {
+                                serverTakeover = false;
+                            } else if ((key == _T("client_no_context_takeover")) && (value.empty() == true) && (clientTakeover == true)) {
+                                clientTakeover = false;
+                            } else if ((key == _T("server_max_window_bits")) && (serverBits == 0)) {
+                                serverBits = WindowBits(value);
+                                // We can not deflate with a window of 8 bits, that offer is not for us.
+                                valid = ((serverBits >= 9) && (serverBits <= 15));
+                            } else if ((key == _T("client_max_window_bits")) && (clientWindow == false)) {
+                                clientBits = WindowBits(value);
+                                clientWindow = true;
+                                valid = (clientBits <= 15);
+                            } else {
+                                valid = false;
+                            }
+                        }
+
+                        if (valid == true) {
+                            _windowBits = (serverBits == 0 ? _settings.WindowBits : std::min(_settings.WindowBits, serverBits));
+                            _contextTakeover = ((serverTakeover == true) && (_settings.ContextTakeover == true));
+                            // Only if the client allows us to, we can ask for a smaller window for what it sends.
+                            _peerWindowBits = (clientWindow == false ? 15 : std::min(_settings.PeerWindowBits, (clientBits == 0 ? static_cast<uint8_t>(15) : clientBits)));
+
+                            response = PerMessageDeflate;
+
+                            if (_contextTakeover == false) {
+                                response += _T("; server_no_context_takeover");
+                            }
+                            if ((serverBits != 0) || (_windowBits < 15)) {
+                                response += _T("; server_max_window_bits=") + Core::NumberType<uint8_t>(_windowBits).Text();
+                            }
+                            if ((clientTakeover == false) || (_settings.PeerContextTakeover == false)) {
+                                response += _T("; client_no_context_takeover");
+                            }
+                            if ((clientWindow == true) && (_peerWindowBits < 15)) {
+                                response += _T("; client_max_window_bits=") + Core::NumberType<uint8_t>(_peerWindowBits).Text();
+                            }
+
+                            _active = true;
+                        }
+                    }
+                }
+            }
+
+            return (_active);
+        }
+
+        void Deflate::Pack(const uint8_t data[], const uint16_t length, const bool final)
+        {
+            const uint64_t start = Core::Time::Now().Ticks();
+
+            if (_deflaterReady == false) {
+                ::memset(&_deflater, 0, sizeof(_deflater));
+                _deflaterReady = (deflateInit2(&_deflater, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -_windowBits, _settings.MemoryLevel, Z_DEFAULT_STRATEGY) == Z_OK);
+                ASSERT(_deflaterReady == true);
+            }
+
+            if (_offset == _pending.size()) {
+                _pending.clear();
+                _offset = 0;
+            }
+
+            _state = DEFLATING;
+
+            const size_t begin = _pending.size();
+
+            _deflater.next_in = const_cast<uint8_t*>(data);
+            _deflater.avail_in = length;
+
+            do {
+                const size_t used = _pending.size();
+                const uint32_t room = std::max(static_cast<uint32_t>(length / 2), static_cast<uint32_t>(256));
+
+                _pending.resize(used + room);
+                _deflater.next_out = &(_pending[used]);
+                _deflater.avail_out = room;
+
+                deflate(&_deflater, (final == true ? Z_SYNC_FLUSH : Z_NO_FLUSH));
+
+                _pending.resize(used + room - _deflater.avail_out);
+            } while (_deflater.avail_out == 0);
+
+            _statistics.Plain += length;
+
+            if (final == true) {
+                // The flush ends with an empty stored block, the receiver adds it back.
+                ASSERT((_pending.size() >= sizeof(DeflateTail)) && (::memcmp(&(_pending[_pending.size() - sizeof(DeflateTail)]), DeflateTail, sizeof(DeflateTail)) == 0));
+
+                _pending.resize(_pending.size() - sizeof(DeflateTail));
+
+                if (_contextTakeover == false) {
+                    deflateReset(&_deflater);
+                }
+
+                _state = FLUSHED;
+                _statistics.Sent++;
+            }
+
+            _statistics.Deflated += (_pending.size() - begin);
+            _statistics.DeflateTime += (Core::Time::Now().Ticks() - start);
+        }
+
+        bool Deflate::Unpack(const uint8_t data[], const uint16_t length)
+        {
+            int status = Z_OK;
+
+            _inflater.next_in = const_cast<uint8_t*>(data);
+            _inflater.avail_in = length;
+
+            do {
+                const size_t used = _message.size();
+                const uint32_t room = std::max(static_cast<uint32_t>(length * 4), static_cast<uint32_t>(1024));
+
+                _message.resize(used + room);
+                _inflater.next_out = &(_message[used]);
+                _inflater.avail_out = room;
+
+                status = inflate(&_inflater, Z_SYNC_FLUSH);
+
+                _message.resize(used + room - _inflater.avail_out);
+
+                if (status == Z_STREAM_END) {
+                    // The peer closed the stream (BFINAL), whatever follows starts a new one.
+                    inflateReset(&_inflater);
+                    status = (_inflater.avail_in == 0 ? Z_BUF_ERROR : Z_OK);
+                }
+
+            } while (((_inflater.avail_out == 0) || (_inflater.avail_in != 0)) && (status == Z_OK) && (_message.size() <= _settings.MaxMessageSize));
+
+            return (((status == Z_OK) || (status == Z_BUF_ERROR)) && (_message.size() <= _settings.MaxMessageSize));
+        }
+
+        bool Deflate::Decompress(const uint8_t data[], const uint16_t length, const bool final)
+        {
+            const uint64_t start = Core::Time::Now().Ticks();
+            bool result = false;
+
+            if (_inflaterReady == false) {
+                ::memset(&_inflater, 0, sizeof(_inflater));
+                _inflaterReady = (inflateInit2(&_inflater, -_peerWindowBits) == Z_OK);
+                ASSERT(_inflaterReady == true);
+            }
+
+            if (_dropping == false) {
+                _statistics.Compressed += length;
+                _receiving = _receiving || (length > 0);
+
+                // A message without any payload is empty, there is no block the tail could close.
+                if ((Unpack(data, length) == false) || ((final == true) && (_receiving == true) && (Unpack(DeflateTail, sizeof(DeflateTail)) == false))) {
+                    // Corrupt or too big, what the peer sends next refers to what we skip, start over.
+                    TRACE_L1("Dropped a compressed message, inflating failed or exceeded %d bytes", _settings.MaxMessageSize);
+                    inflateReset(&_inflater);
+                    _message.clear();
+                    _dropping = true;
+                    _statistics.Dropped++;
+                }
+            }
+
+            if (final == true) {
+                result = (_dropping == false);
+
+                if (result == true) {
+                    _statistics.Received++;
+                    _statistics.Inflated += _message.size();
+                }
+
+                _dropping = false;
+                _receiving = false;
+            }
+
+            _statistics.InflateTime += (Core::Time::Now().Ticks() - start);
+
+            return (result);
+        }
+
         static const uint8_t CONTINUATION_FRAME = 0x00;
         static const uint8_t FINISHING_FRAME = 0x80;
         static const uint8_t TYPE_FRAME = 0x0F;
         static const uint8_t MASKING_FRAME = 0x80;
         static const uint8_t CONTROL_FRAME = 0x08;
+        static const uint8_t COMPRESSED_FRAME = 0x40;
         static const uint8_t HandShakeKey[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
         std::string Protocol::RequestKey() const
@@ -68,6 +454,71 @@ namespace Web {
             return (baseEncodedKey);
         }
 
+#if defined(__AVX2__)
+        typedef __m256i MaskVector;
+#elif defined(__SSE2__)
+        typedef __m128i MaskVector;
+#else
+        typedef uint64_t MaskVector;
+#endif
+
+        /* static */ uint8_t Protocol::Mask(uint8_t data[], const uint32_t length, const uint8_t key[4], const uint8_t phase)
+        {
+            uint8_t* current = data;
+            uint8_t* const end = &(data[length]);
+            uint8_t index = (phase & 0x03);
+
+            // Byte by byte until the data is aligned for the wide stores..
+            while ((current != end) && ((reinterpret_cast<uintptr_t>(current) & (sizeof(MaskVector) - 1)) != 0)) {
+                *current++ ^= key[index];
+                index = (index + 1) & 0x03;
+            }
+
+            if (static_cast<uint32_t>(end - current) >= sizeof(uint64_t)) {
+                // A word holding the key, starting at the current phase. Every word/vector is a multiple of
+                // four bytes, so the phase does not change over the bulk of the data.
+                uint8_t rotated[sizeof(uint64_t)];
+                uint64_t word;
+
+                for (uint8_t teller = 0; teller < sizeof(rotated); teller++) {
+                    rotated[teller] = key[(index + teller) & 0x03];
+                }
+                ::memcpy(&word, rotated, sizeof(word));
+
+#if defined(__AVX2__)
+                const __m256i wide = _mm256_set1_epi64x(static_cast<long long>(word));
+
+                while (static_cast<uint32_t>(end - current) >= sizeof(__m256i)) {
+                    __m256i* location = reinterpret_cast<__m256i*>(current);
+                    _mm256_store_si256(location, _mm256_xor_si256(_mm256_load_si256(location), wide));
+                    current += sizeof(__m256i);
+                }
+#elif defined(__SSE2__)
+                const __m128i wide = _mm_set1_epi64x(static_cast<long long>(word));
+
+                while (static_cast<uint32_t>(end - current) >= sizeof(__m128i)) {
+                    __m128i* location = reinterpret_cast<__m128i*>(current);
+                    _mm_store_si128(location, _mm_xor_si128(_mm_load_si128(location), wide));
+                    current += sizeof(__m128i);
+                }
+#endif
+                while (static_cast<uint32_t>(end - current) >= sizeof(uint64_t)) {
+                    uint64_t value;
+                    ::memcpy(&value, current, sizeof(value));
+                    value ^= word;
+                    ::memcpy(current, &value, sizeof(value));
+                    current += sizeof(uint64_t);
+                }
+            }
+
+            while (current != end) {
+                *current++ ^= key[index];
+                index = (index + 1) & 0x03;
+            }
+
+            return (index);
+        }
+
         /*  %x0 denotes a continuation frame
  *  %x1 denotes a text frame
  *  %x2 denotes a binary frame
@@ -100,15 +551,10 @@ namespace Web {
                     maskKey[2] = (value >> 16) & 0xFF;
                     maskKey[3] = (value >> 24) & 0xFF;
 
-                    // Mask and insert the bytes on the right spots
-                    uint8_t* source = &dataFrame[usedSize - 1 + 4];
-                    uint8_t* destination = &dataFrame[usedSize - 1 + 4 + result];
-                    uint32_t bytesToMove = usedSize;
-
-                    while (bytesToMove != 0) {
-                        bytesToMove--;
-                        *destination-- = (*source ^ maskKey[(bytesToMove & 0x3)]);
-                        source--;
+                    // Move the bytes to the right spots and mask them there.
+                    if (usedSize != 0) {
+                        ::memmove(&dataFrame[4 + result], &dataFrame[4], usedSize);
+                        Mask(&dataFrame[4 + result], usedSize, maskKey, 0);
                     }
 
                     // Now there is space again, write down the encryption key.
@@ -127,11 +573,11 @@ namespace Web {
 
                 if (usedSize < maxSendSize) {
                     // Seems like not all available space is used, so I guess we are ready..
-                    dataFrame[0] = FINISHING_FRAME | (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = FINISHING_FRAME | (SendInProgress() == true ? CONTINUATION_FRAME : (TYPE_FRAME | COMPRESSED_FRAME) & _setFlags);
                     _progressInfo &= (~0x40);
                 } else {
                     // There is more to come, this is just part of a bigger picture
-                    dataFrame[0] = (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = (SendInProgress() == true ? CONTINUATION_FRAME : (TYPE_FRAME | COMPRESSED_FRAME) & _setFlags);
                     _progressInfo |= (0x40);
                 }
 
@@ -169,18 +615,12 @@ namespace Web {
                 // Just unscramble, what is left...
                 if ((_progressInfo & 0x20) == 0x20) {
                     // looks like we need to unscramble..
-                    uint8_t* source = dataFrame;
-
                     if (_pendingReceiveBytes < receivedSize) {
                         receivedSize = _pendingReceiveBytes;
                     }
 
-                    for (uint16_t tmp = receivedSize; _pendingReceiveBytes != 0 && tmp != 0; --tmp) {
-                        *source = (*source ^ _scrambleKey[(_progressInfo & 0x3)]);
-                        source++;
-                        _progressInfo = ((_progressInfo + 1) & 0x03) | (_progressInfo & 0xFC);
-                        _pendingReceiveBytes--;
-                    }
+                    _progressInfo = Mask(dataFrame, receivedSize, _scrambleKey, _progressInfo) | (_progressInfo & 0xFC);
+                    _pendingReceiveBytes -= receivedSize;
                 } else {
                     if (_pendingReceiveBytes > receivedSize) {
                         _pendingReceiveBytes -= receivedSize;
@@ -206,6 +646,15 @@ namespace Web {
                 } else {
                     _frameType = static_cast<frameType>(dataFrame[0] & TYPE_FRAME);
 
+                    // The RSV1 bit on the first frame of a message, tells if the whole message is compressed.
+                    if ((_frameType != 0) && ((_frameType & CONTROL_FRAME) == 0)) {
+                        if ((dataFrame[0] & COMPRESSED_FRAME) != 0) {
+                            _progressInfo |= 0x10;
+                        } else {
+                            _progressInfo &= (~0x10);
+                        }
+                    }
+
                     // Continuation frame is only allowed if a receive is in progress...
                     if (ReceiveInProgress() == true) {
                         if (_frameType == 0) {
@@ -261,14 +710,7 @@ namespace Web {
                             _progressInfo |= 0x20;
                             _progressInfo &= (~0x03);
 
-                            uint8_t* source = &dataFrame[actualHeader];
-
-                            while (bytesToMove != 0) {
-                                *source = (*source ^ _scrambleKey[(_progressInfo & 0x3)]);
-                                source++;
-                                bytesToMove--;
-                                _progressInfo = ((_progressInfo + 1) & 0xF3);
-                            }
+                            _progressInfo = Mask(&dataFrame[actualHeader], static_cast<uint32_t>(bytesToMove), _scrambleKey, 0) | (_progressInfo & 0xF0);
                         }
                     }
                 }
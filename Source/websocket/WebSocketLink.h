@@ -27,6 +27,163 @@
 namespace WPEFramework {
 namespace Web {
     namespace WebSocket {
+        // RFC 7692, permessage-deflate. Negotiated during the upgrade, from there on the messages we send are
+        // deflated and the messages received with the RSV1 bit set are inflated before they are handed over.
+        class EXTERNAL Deflate {
+        public:
+            struct Settings {
+                Settings()
+                    : WindowBits(15)
+                    , PeerWindowBits(15)
+                    , ContextTakeover(true)
+                    , PeerContextTakeover(true)
+                    , MemoryLevel(8)
+                    , MaxMessageSize(1024 * 1024)
+                {
+                }
+
+                uint8_t WindowBits; // Window (9..15) used for what we send.
+                uint8_t PeerWindowBits; // Window (9..15) we ask the peer to use, bounds the memory of our inflater.
+                bool ContextTakeover; // Keep our dictionary between the messages we send.
+                bool PeerContextTakeover; // Allow the peer to keep its dictionary between the messages it sends.
+                uint8_t MemoryLevel; // zlib memory level (1..9) of our deflater.
+                uint32_t MaxMessageSize; // Largest inflated message accepted, larger messages are dropped.
+            };
+
+            struct Statistics {
+                uint32_t Sent; // Deflated messages
+                uint32_t Received; // Inflated messages
+                uint32_t Dropped; // Messages that failed to inflate or were too big
+                uint64_t Plain; // Bytes offered to the deflater
+                uint64_t Deflated; // Bytes it produced
+                uint64_t Compressed; // Bytes offered to the inflater
+                uint64_t Inflated; // Bytes it produced
+                uint64_t DeflateTime; // Time spent deflating (uS)
+                uint64_t InflateTime; // Time spent inflating (uS)
+            };
+
+        private:
+            enum state : uint8_t {
+                IDLE,
+                DEFLATING,
+                FLUSHED
+            };
+
+        public:
+            Deflate(const Deflate&) = delete;
+            Deflate& operator=(const Deflate&) = delete;
+
+            Deflate();
+            ~Deflate();
+
+        public:
+            // Settings to offer (client) or accept (server) compression with, without them nothing is negotiated.
+            void Configure(const Settings& settings);
+            bool IsConfigured() const
+            {
+                return (_configured);
+            }
+            // Both sides agreed on compressing messages.
+            bool IsActive() const
+            {
+                return (_active);
+            }
+            // We deflate what we send, the window the peer allows might not be one we can deflate with.
+            bool IsCompressing() const
+            {
+                return ((_active == true) && (_windowBits != 0));
+            }
+            const Statistics& Counters() const
+            {
+                return (_statistics);
+            }
+
+            // Client side, the Sec-WebSocket-Extensions value to offer and the evaluation of the answer.
+            string Offer() const;
+            bool Agree(const string& response);
+
+            // Server side, pick an offer we can live with and compose the answer for it.
+            bool Accept(const string& offers, string& response);
+
+            void Reset();
+
+            // Fill a frame with deflated data, taken from the source. A frame that is not filled completely
+            // ends the message, just as it does for the plain data coming from the source.
+            template <typename SOURCE>
+            uint16_t Compress(uint8_t frame[], const uint16_t length, SOURCE& source)
+            {
+                uint16_t loaded = Drain(frame, length);
+
+                while ((loaded < length) && (_state != FLUSHED)) {
+                    if (_plain.size() < length) {
+                        _plain.resize(length);
+                    }
+
+                    uint16_t size = source.SendData(_plain.data(), length);
+
+                    if ((size == 0) && (_state == IDLE)) {
+                        // Nothing to send..
+                        break;
+                    }
+
+                    Pack(_plain.data(), size, (size < length));
+
+                    loaded += Drain(&(frame[loaded]), length - loaded);
+                }
+
+                if ((_state == FLUSHED) && (_offset == _pending.size()) && (loaded < length)) {
+                    // All of the message is out and this frame closes it.
+                    _state = IDLE;
+                    _pending.clear();
+                    _offset = 0;
+                }
+
+                return (loaded);
+            }
+
+            // Inflate a part of a received message. Returns true if the message is completed and inflated.
+            bool Decompress(const uint8_t data[], const uint16_t length, const bool final);
+            std::vector<uint8_t>& Message()
+            {
+                return (_message);
+            }
+
+        private:
+            void Pack(const uint8_t data[], const uint16_t length, const bool final);
+            bool Unpack(const uint8_t data[], const uint16_t length);
+            uint16_t Drain(uint8_t frame[], const uint16_t length)
+            {
+                uint16_t loaded = static_cast<uint16_t>(std::min(static_cast<size_t>(length), _pending.size() - _offset));
+
+                if (loaded > 0) {
+                    ::memcpy(frame, &(_pending[_offset]), loaded);
+                    _offset += loaded;
+                }
+
+                return (loaded);
+            }
+
+        private:
+            Settings _settings;
+            bool _configured;
+            bool _active;
+            uint8_t _windowBits;
+            uint8_t _peerWindowBits;
+            bool _contextTakeover;
+            bool _deflaterReady;
+            bool _inflaterReady;
+            bool _dropping;
+            bool _receiving;
+            state _state;
+            z_stream _deflater;
+            z_stream _inflater;
+            std::vector<uint8_t> _plain;
+            std::vector<uint8_t> _pending;
+            size_t _offset;
+            std::vector<uint8_t> _message;
+            Statistics _statistics;
+        };
+
         class EXTERNAL Protocol {
         public:
             enum frameType {
@@ -118,10 +275,28 @@ namespace Web {
             {
                 return ((_setFlags & 0x80) != 0);
             }
+            // Mark the messages we send as compressed (RSV1).
+            void Compression(const bool compression)
+            {
+                _setFlags = (compression ? (_setFlags | 0x40) : (_setFlags & 0xBF));
+            }
+            bool Compression() const
+            {
+                return ((_setFlags & 0x40) != 0);
+            }
+            // The message being received was marked as compressed (RSV1).
+            bool IsCompressed() const
+            {
+                return ((_progressInfo & 0x10) != 0);
+            }
 
             uint16_t Encoder(uint8_t* dataFrame, const uint16_t maxSendSize, const uint16_t usedSize);
             uint16_t Decoder(uint8_t* dataFrame, uint16_t& receivedSize);
 
+            // Applies the masking key, in place. The phase is the key byte for the first data byte, the
+            // phase for the byte following the data is returned, so a frame can be masked in parts.
+            static uint8_t Mask(uint8_t data[], const uint32_t length, const uint8_t key[4], const uint8_t phase);
+
         private:
             uint8_t _setFlags;
             uint8_t _progressInfo;
@@ -370,6 +545,8 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _inflated(0)
             {
             }
             template <typename... Args>
@@ -387,6 +564,8 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _inflated(0)
             {
             }
 POP_WARNING()
@@ -429,7 +608,8 @@ POP_WARNING()
             }
             bool IsCompleted() const
             {
-                return (_handler.ReceiveInProgress() == false);
+                // An inflated message is handed over in parts, only the last one completes it.
+                return ((_handler.ReceiveInProgress() == false) && (_inflated == 0));
             }
             const string& Path() const
             {
@@ -479,6 +659,24 @@ POP_WARNING()
             {
                 return (_handler.Masking());
             }
+            void Compression(const WebSocket::Deflate::Settings& settings)
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(_adminLock);
+
+                _deflate.Configure(settings);
+            }
+            bool IsCompressed() const
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(_adminLock);
+
+                return (_deflate.IsActive());
+            }
+            WebSocket::Deflate::Statistics Compression() const
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(_adminLock);
+
+                return (_deflate.Counters());
+            }
             bool Upgrade(const string& protocol, const string& path)
             {
                 string empty;
@@ -544,7 +742,11 @@ POP_WARNING()
 
                 if ((_state & WEBSOCKET) != 0) {
                     if (maxSendSize > 4) {
-                        result = _parent.SendData(&(dataFrame[4]), (maxSendSize - 4));
+                        if (_handler.Compression() == true) {
+                            result = _deflate.Compress(&(dataFrame[4]), (maxSendSize - 4), _parent);
+                        } else {
+                            result = _parent.SendData(&(dataFrame[4]), (maxSendSize - 4));
+                        }
 
                         result = _handler.Encoder(dataFrame, (maxSendSize - 4), result);
                     }
@@ -643,6 +845,15 @@ POP_WARNING()
 
                                 result += static_cast<uint16_t>(headerSize + payloadSizeInControlFrame); // actualDataSize
 
+                            } else if ((_handler.IsCompressed() == true) && (_deflate.IsActive() == true)) {
+                                // Only the final frame, completely received, ends the message.
+                                const bool final = ((_handler.ReceiveInProgress() == false) && (_handler.IsCompleteMessage() == true));
+
+                                if (_deflate.Decompress(&(dataFrame[result + headerSize]), actualDataSize, final) == true) {
+                                    Inflated(_deflate.Message());
+                                }
+
+                                result += (headerSize + actualDataSize);
                             } else {
                                 _parent.ReceiveData(&(dataFrame[result + headerSize]), actualDataSize);
 
@@ -701,6 +912,22 @@ POP_WARNING()
             }
 
         private:
+            void Inflated(std::vector<uint8_t>& message)
+            {
+                uint32_t offset = 0;
+
+                while (offset < message.size()) {
+                    const uint16_t size = static_cast<uint16_t>(std::min(message.size() - offset, static_cast<size_t>(0xFFFF)));
+
+                    offset += size;
+                    _inflated = static_cast<uint32_t>(message.size() - offset);
+
+                    _parent.ReceiveData(&(message[offset - size]), size);
+                }
+
+                _inflated = 0;
+                message.clear();
+            }
             uint32_t CheckForClose(uint32_t waitTime)
             {
                 uint32_t result = 0;
@@ -791,6 +1018,14 @@ POP_WARNING()
                             _webSocketMessage->Connection = Web::Response::CONNECTION_UPGRADE;
                             _webSocketMessage->Upgrade = Web::Response::UPGRADE_WEBSOCKET;
                             _webSocketMessage->WebSocketAccept = _handler.ResponseKey(element->WebSocketKey.Value());
+
+                            string extensions;
+                            if ((element->WebSocketExtensions.IsSet() == true) && (_deflate.Accept(element->WebSocketExtensions.Value(), extensions) == true)) {
+                                _webSocketMessage->WebSocketExtensions = extensions;
+                            } else {
+                                _webSocketMessage->WebSocketExtensions.Clear();
+                            }
+                            _handler.Compression(_deflate.IsCompressing());
                             if (_protocol.Empty() == false) {
                                 //only one protocol should be selected
                                 ASSERT(_protocol.Size() == 1);
@@ -858,6 +1093,13 @@ POP_WARNING()
                         _webSocketMessage->WebSocketProtocol = Web::ProtocolsArray(protocol);
                     }
 
+                    _deflate.Reset();
+                    _handler.Compression(false);
+
+                    if (_deflate.IsConfigured() == true) {
+                        _webSocketMessage->WebSocketExtensions = _deflate.Offer();
+                    }
+
                     _query = query;
                     _path = path;
                     _protocol = Web::ProtocolsArray(protocol);
@@ -882,6 +1124,18 @@ POP_WARNING()
 
                     _adminLock.Lock();
 
+                    if ((element->WebSocketExtensions.IsSet() == true) && (_deflate.Agree(element->WebSocketExtensions.Value()) == false)) {
+                        // An extension we did not offer or can not live with, the connection has to fail.
+                        TRACE_L1("Unsupported WebSocket extension: %s", element->WebSocketExtensions.Value().c_str());
+                        _adminLock.Unlock();
+
+                        Close(0);
+
+                        return;
+                    }
+
+                    _handler.Compression(_deflate.IsCompressing());
+
                     // Seems like we succeeded, turn on the link..
                     _state = (_state & 0xF0) | WEBSOCKET;
 
@@ -914,6 +1168,8 @@ POP_WARNING()
             string _commandData;
             Core::ProxyType<typename OUTBOUND::BaseElement> _webSocketMessage;
             uint64_t _pingFireTime;
+            WebSocket::Deflate _deflate;
+            uint32_t _inflated;
         };
 
     public:
@@ -996,6 +1252,19 @@ POP_WARNING()
         {
             return (_channel.Masking());
         }
+        // Offer (client) or accept (server) permessage-deflate with these settings, before upgrading.
+        void Compression(const WebSocket::Deflate::Settings& settings)
+        {
+            _channel.Compression(settings);
+        }
+        bool IsCompressed() const
+        {
+            return (_channel.IsCompressed());
+        }
+        WebSocket::Deflate::Statistics Compression() const
+        {
+            return (_channel.Compression());
+        }
         void ResetActivity()
         {
             return (_channel.ResetActivity());
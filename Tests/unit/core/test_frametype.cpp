@@ -62,3 +62,40 @@ TEST(test_frame, simple_set)
     EXPECT_EQ(obj1.Size(), Size);
     obj1.Clear();
 }
+
+TEST(test_frame, size_classes)
+{
+    FrameStatistics::Reset();
+
+    FrameType<512, true, uint32_t> frame;
+    EXPECT_EQ(FrameStatistics::Allocations(), 1u);
+
+    // Growing a byte at a time, only reallocates when the next size class is needed: 1K, 2K, .. 64K.
+    FrameType<512, true, uint32_t>::Writer writer(frame, 0);
+    for (uint32_t index = 0; index < (64 * 1024); ++index) {
+        writer.Number<uint8_t>(static_cast<uint8_t>(index));
+    }
+    EXPECT_EQ(FrameStatistics::Reallocations(), 7u);
+
+    // Reused, it fits without growing.
+    frame.Clear();
+    FrameType<512, true, uint32_t>::Writer again(frame, 0);
+    for (uint32_t index = 0; index < (64 * 1024); ++index) {
+        again.Number<uint8_t>(static_cast<uint8_t>(index));
+    }
+    EXPECT_EQ(FrameStatistics::Reallocations(), 7u);
+
+    // Reserved up front, it grows once.
+    FrameType<512, true, uint32_t> reserved;
+    reserved.Reserve(10000);
+    reserved.Size(10000);
+    EXPECT_EQ(FrameStatistics::Allocations(), 2u);
+    EXPECT_EQ(FrameStatistics::Reallocations(), 8u);
+
+    // The size classes never exceed what the frame can address.
+    FrameType<512> small;
+    small.Size(40000);
+    small[39999] = 0xAA;
+    EXPECT_EQ(small.Size(), 40000u);
+    EXPECT_EQ(small[39999], 0xAA);
+}
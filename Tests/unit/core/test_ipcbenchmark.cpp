@@ -0,0 +1,304 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+namespace WPEFramework {
+namespace Tests {
+
+    struct Call {
+        uint32_t Delay; // uS the method takes
+        uint32_t Value;
+    };
+
+    typedef Core::IPCMessageType<1, Call, Core::IPC::ScalarType<uint32_t>> CallMessage;
+
+    // Like the COM-RPC invoke servers, hand the calls to a pool so they are answered in whatever order they complete.
+    class CallServer : public Core::IIPCServer {
+    private:
+        class Dispatcher : public Core::ThreadPool::IDispatcher {
+        public:
+            Dispatcher(const Dispatcher&) = delete;
+            Dispatcher& operator=(const Dispatcher&) = delete;
+
+            Dispatcher() = default;
+            ~Dispatcher() override = default;
+
+        private:
+            void Initialize() override {
+            }
+            void Deinitialize() override {
+            }
+            void Dispatch(Core::IDispatch* job) override {
+                job->Dispatch();
+            }
+        };
+        class Job : public Core::IDispatch {
+        public:
+            Job() = delete;
+            Job(const Job&) = delete;
+            Job& operator=(const Job&) = delete;
+
+            Job(Core::IPCChannel& channel, const Core::ProxyType<Core::IIPC>& message)
+                : _channel(channel)
+                , _message(message)
+            {
+            }
+            ~Job() override = default;
+
+        public:
+            void Dispatch() override
+            {
+                Core::ProxyType<CallMessage> message(_message);
+
+                if (message->Parameters().Delay != 0) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(message->Parameters().Delay));
+                }
+
+                message->Response() = (message->Parameters().Value * 2) + 1;
+                _channel.ReportResponse(_message);
+            }
+
+        private:
+            Core::IPCChannel& _channel;
+            Core::ProxyType<Core::IIPC> _message;
+        };
+
+    public:
+        CallServer(const CallServer&) = delete;
+        CallServer& operator=(const CallServer&) = delete;
+
+        CallServer()
+            : _dispatcher()
+            , _pool(16, 0, 256, &_dispatcher, nullptr)
+        {
+            _pool.Run();
+        }
+        ~CallServer() override
+        {
+            _pool.Stop();
+        }
+
+    public:
+        void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
+        {
+            _pool.Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<Job>::Create(source, message)), Core::infinite);
+        }
+
+    private:
+        Dispatcher _dispatcher;
+        Core::ThreadPool _pool;
+    };
+
+    class Connection {
+    public:
+        Connection(const Connection&) = delete;
+        Connection& operator=(const Connection&) = delete;
+
+        Connection(const TCHAR connector[], const TCHAR lane[] = nullptr)
+            : _node(connector)
+            , _serverFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create())
+            , _clientFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>>::Create())
+            , _server(_node, 1024, _serverFactory)
+            , _client(_node, 1024, _clientFactory)
+            , _handler(Core::ProxyType<CallServer>::Create())
+        {
+            _serverFactory->CreateFactory<CallMessage>(16);
+            _clientFactory->CreateFactory<CallMessage>(16);
+
+            _server.Register(CallMessage::Id(), _handler);
+
+            EXPECT_EQ(_server.Source().Open(1000), Core::ERROR_NONE);
+            EXPECT_EQ(_client.Source().Open(1000), Core::ERROR_NONE);
+
+            if (lane != nullptr) {
+                EXPECT_EQ(_server.OpenLane(lane, true), Core::ERROR_NONE);
+                EXPECT_EQ(_client.OpenLane(lane, false), Core::ERROR_NONE);
+            }
+        }
+        ~Connection()
+        {
+            _client.Source().Close(1000);
+            _server.Source().Close(1000);
+            _server.Unregister(CallMessage::Id());
+
+            _serverFactory->DestroyFactories();
+            _clientFactory->DestroyFactories();
+        }
+
+    public:
+        uint32_t Invoke(const uint32_t delay, const uint32_t value, const uint32_t waitTime, uint32_t& result)
+        {
+            Core::ProxyType<CallMessage> message(Core::ProxyType<CallMessage>::Create());
+
+            message->Parameters().Delay = delay;
+            message->Parameters().Value = value;
+
+            uint32_t error = _client.Invoke(message, waitTime);
+
+            result = message->Response();
+
+            return (error);
+        }
+        const Core::IPCLane& ServerLane() const
+        {
+            return (_server.Lane());
+        }
+
+    private:
+        Core::NodeId _node;
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> _serverFactory;
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t>> _clientFactory;
+        Core::IPCChannelClientType<Core::Void, true, false> _server;
+        Core::IPCChannelClientType<Core::Void, false, false> _client;
+        Core::ProxyType<Core::IIPCServer> _handler;
+    };
+
+    // Returns the calls/s the callers got out of the connection.
+    static uint64_t Measure(Connection& connection, const uint32_t callers, const uint32_t calls, const uint32_t delay)
+    {
+        std::vector<std::thread> threads;
+        std::atomic<uint32_t> failures(0);
+        const uint32_t perCaller = calls / callers;
+
+        const uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint32_t caller = 0; caller < callers; ++caller) {
+            threads.emplace_back([&, caller]() {
+                for (uint32_t index = 0; index < perCaller; ++index) {
+                    const uint32_t value = (caller << 16) | index;
+                    uint32_t result = 0;
+
+                    if ((connection.Invoke(delay, value, 5000, result) != Core::ERROR_NONE) || (result != ((value * 2) + 1))) {
+                        failures++;
+                    }
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        const uint64_t duration = std::max(Core::Time::Now().Ticks() - start, static_cast<uint64_t>(1));
+
+        EXPECT_EQ(failures.load(), 0u);
+
+        return ((static_cast<uint64_t>(perCaller) * callers * Core::Time::TicksPerMillisecond * 1000) / duration);
+    }
+
+    TEST(Core_IPCBenchmark, OutOfOrder)
+    {
+        Connection connection(_T("/tmp/ipcbenchmark0"));
+        uint32_t slowResult = 0;
+        uint32_t slowError = Core::ERROR_GENERAL;
+
+        std::thread slow([&]() {
+            slowError = connection.Invoke(500000, 1, 5000, slowResult);
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // The slow call is still out, this one should not have to wait for it.
+        const uint64_t start = Core::Time::Now().Ticks();
+        uint32_t result = 0;
+
+        EXPECT_EQ(connection.Invoke(0, 2, 5000, result), Core::ERROR_NONE);
+        EXPECT_EQ(result, 5u);
+        EXPECT_LT(Core::Time::Now().Ticks() - start, 250u * Core::Time::TicksPerMillisecond);
+
+        slow.join();
+
+        EXPECT_EQ(slowError, Core::ERROR_NONE);
+        EXPECT_EQ(slowResult, 3u);
+
+        // A call that times out, does not complete the one after it with its late response.
+        EXPECT_EQ(connection.Invoke(200000, 3, 50, result), Core::ERROR_TIMEDOUT);
+        EXPECT_EQ(connection.Invoke(0, 4, 5000, result), Core::ERROR_NONE);
+        EXPECT_EQ(result, 9u);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    }
+
+    TEST(Core_IPCBenchmark, Throughput)
+    {
+        // A method that takes 200 uS, what the callers on one channel get out of it.
+        static constexpr uint32_t Delay = 200;
+        static constexpr uint32_t Calls = 2000;
+
+        Connection connection(_T("/tmp/ipcbenchmark1"));
+
+        for (const uint32_t callers : { 1, 2, 4, 8, 16 }) {
+            std::cout << "IPC [" << callers << " callers]: " << Measure(connection, callers, Calls, Delay) << " calls/s" << std::endl;
+        }
+    }
+
+    TEST(Core_IPCBenchmark, Lane)
+    {
+        static constexpr uint32_t Calls = 4000;
+
+        Connection connection(_T("/tmp/ipcbenchmark2"), _T("/tmp/ipcbenchmark2.lane"));
+        uint32_t result = 0;
+
+        // Until the client used the lane, the server does not know it is there.
+        EXPECT_TRUE(connection.ServerLane().IsOpen());
+        EXPECT_FALSE(connection.ServerLane().IsEstablished());
+
+        EXPECT_EQ(connection.Invoke(0, 1, 5000, result), Core::ERROR_NONE);
+        EXPECT_EQ(result, 3u);
+        EXPECT_TRUE(connection.ServerLane().IsEstablished());
+
+        // Calls on the lane complete out of order, just like the ones on the socket.
+        uint32_t slowResult = 0;
+        uint32_t slowError = Core::ERROR_GENERAL;
+
+        std::thread slow([&]() {
+            slowError = connection.Invoke(500000, 2, 5000, slowResult);
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        const uint64_t start = Core::Time::Now().Ticks();
+
+        EXPECT_EQ(connection.Invoke(0, 3, 5000, result), Core::ERROR_NONE);
+        EXPECT_EQ(result, 7u);
+        EXPECT_LT(Core::Time::Now().Ticks() - start, 250u * Core::Time::TicksPerMillisecond);
+
+        slow.join();
+
+        EXPECT_EQ(slowError, Core::ERROR_NONE);
+        EXPECT_EQ(slowResult, 5u);
+
+        Connection socket(_T("/tmp/ipcbenchmark3"));
+
+        for (const uint32_t callers : { 1, 4 }) {
+            const uint64_t overSocket = Measure(socket, callers, Calls, 0);
+            const uint64_t overLane = Measure(connection, callers, Calls, 0);
+
+            std::cout << "IPC [" << callers << " callers]: socket " << overSocket << " calls/s, lane " << overLane << " calls/s" << std::endl;
+        }
+    }
+} // Tests
+} // WPEFramework
@@ -2503,5 +2503,397 @@ namespace Tests {
             EXPECT_STREQ(input.c_str(), output.c_str());
         }
     }
+
+    TEST(JSONParser, JSONRPCParameters)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const Core::ProxyType<Core::JSONRPC::Notification::Body>&) {}, { 1 });
+
+        handler.Register<ParamsInfo, Core::JSON::String>(_T("connect"), [](const ParamsInfo& parameters, Core::JSON::String& result) -> uint32_t {
+            result = parameters.Ssid.Value();
+            return (Core::ERROR_NONE);
+        });
+        handler.Register<Core::JSON::String, Core::JSON::String>(_T("echo"), [](const Core::JSON::String& parameters, Core::JSON::String& result) -> uint32_t {
+            result = parameters.Value();
+            return (Core::ERROR_NONE);
+        });
+
+        string storage;
+        string response;
+        Core::JSONRPC::Message message;
+
+        // Objects are handed out as received, no copy is made.
+        message.FromString(R"({"jsonrpc":"2.0","id":1,"method":"WifiControl.1.connect","params":{"ssid":"Thunder"}})");
+        EXPECT_EQ(&(message.Params(storage)), &(message.Parameters.Opaque()));
+        EXPECT_STREQ(message.Params(storage).c_str(), message.Parameters.Value().c_str());
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), message, response), Core::ERROR_NONE);
+        EXPECT_STREQ(response.c_str(), _T("\"Thunder\""));
+
+        // A string gets its quotes back.
+        message.Clear();
+        message.FromString(R"({"jsonrpc":"2.0","id":2,"method":"WifiControl.1.echo","params":"Thunder"})");
+        EXPECT_EQ(&(message.Params(storage)), &storage);
+        EXPECT_STREQ(message.Params(storage).c_str(), message.Parameters.Value().c_str());
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), message, response), Core::ERROR_NONE);
+        EXPECT_STREQ(response.c_str(), _T("\"Thunder\""));
+
+        message.Clear();
+        message.FromString(R"({"jsonrpc":"2.0","id":3,"method":"WifiControl.1.unknown","params":{}})");
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), message, response), Core::ERROR_UNKNOWN_KEY);
+    }
+
+    TEST(JSONParser, WideContainer)
+    {
+        // Enough members to have the labels looked up through the index.
+        class Wide : public Core::JSON::Container {
+        public:
+            Wide()
+                : Core::JSON::Container()
+            {
+                for (uint8_t index = 0; index < 32; index++) {
+                    Labels[index] = string(_T("member")) + Core::NumberType<uint8_t>(index).Text();
+                    Add(Labels[index].c_str(), &Values[index]);
+                }
+                Add(_T("member7"), &Duplicate);
+            }
+            using Core::JSON::Container::Remove;
+
+        public:
+            string Labels[32];
+            Core::JSON::DecUInt32 Values[32];
+            Core::JSON::DecUInt32 Duplicate;
+        };
+
+        Wide data;
+        string text;
+
+        EXPECT_TRUE(data.HasLabel(_T("member0")));
+        EXPECT_TRUE(data.HasLabel(_T("member31")));
+        EXPECT_FALSE(data.HasLabel(_T("member32")));
+
+        data.FromString(_T("{\"member31\":31,\"member7\":7,\"member0\":1,\"unknown\":5}"));
+        EXPECT_EQ(data.Values[31].Value(), 31u);
+        EXPECT_EQ(data.Values[0].Value(), 1u);
+        // On a duplicate label, the first one added wins.
+        EXPECT_EQ(data.Values[7].Value(), 7u);
+        EXPECT_FALSE(data.Duplicate.IsSet());
+
+        // Serialized in the order the members were added, whatever the order they were parsed in.
+        data.ToString(text);
+        EXPECT_STREQ(text.c_str(), _T("{\"member0\":1,\"member7\":7,\"member31\":31}"));
+
+        // Removing a label drops it from the index as well.
+        data.Clear();
+        data.Remove(data.Labels[7].c_str());
+        EXPECT_TRUE(data.HasLabel(_T("member7")));
+        data.FromString(_T("{\"member7\":8}"));
+        EXPECT_FALSE(data.Values[7].IsSet());
+        EXPECT_EQ(data.Duplicate.Value(), 8u);
+    }
+
+    TEST(JSONParser, Scanner)
+    {
+        // Runs of all lengths, so both the vectorized and the byte by byte part get their turn.
+        for (uint16_t length = 0; length < 80; length++) {
+            const string spaces(string(length, ' ') + _T("\t\r\n\v\f"));
+            string plain(length, 'a');
+            string opaque(length, ':');
+
+            EXPECT_EQ(Core::JSON::Scanner::Whitespace((spaces + _T("x")).c_str(), spaces.length() + 1), spaces.length());
+            EXPECT_EQ(Core::JSON::Scanner::Whitespace(spaces.c_str(), length), length);
+
+            EXPECT_EQ(Core::JSON::Scanner::Plain((plain + _T("\\")).c_str(), plain.length() + 1), length);
+            EXPECT_EQ(Core::JSON::Scanner::Plain((plain + _T("\"")).c_str(), plain.length() + 1), length);
+            EXPECT_EQ(Core::JSON::Scanner::Plain((plain + _T("\"")).c_str(), length), length);
+
+            for (const TCHAR structural : { '\"', ',', '{', '}', '[', ']' }) {
+                EXPECT_EQ(Core::JSON::Scanner::Opaque((opaque + structural).c_str(), opaque.length() + 1), length);
+            }
+            // Neighbours of the brackets are not structural.
+            EXPECT_EQ(Core::JSON::Scanner::Opaque((opaque + _T("|z\\y")).c_str(), opaque.length() + 4), length + 4);
+        }
+
+        // Whatever the size of the chunks, the result is the same as parsing it at once.
+        const string text(_T("{  \"label\" :  \"A rather long string, with an \\\"escape\\\" or \\u0041 in it, well over thirty-two characters\",\n\t")
+                          _T("\"opaque\": { \"nested\" : [1, 2, {\"deep\": \"text, with [brackets] in it\"}], \"other\": true }   }"));
+
+        class Data : public Core::JSON::Container {
+        public:
+            Data()
+                : Core::JSON::Container()
+                , Label()
+                , Opaque(false)
+            {
+                Add(_T("label"), &Label);
+                Add(_T("opaque"), &Opaque);
+            }
+
+        public:
+            Core::JSON::String Label;
+            Core::JSON::String Opaque;
+        };
+
+        Data reference;
+        reference.FromString(text);
+        EXPECT_STREQ(reference.Label.Value().c_str(), _T("A rather long string, with an \"escape\" or A in it, well over thirty-two characters"));
+        EXPECT_STREQ(reference.Opaque.Value().c_str(), _T("{ \"nested\" : [1, 2, {\"deep\": \"text, with [brackets] in it\"}], \"other\": true }"));
+
+        for (const uint16_t chunk : { 1, 3, 17, 33 }) {
+            Data data;
+            uint32_t offset = 0;
+            uint16_t handled = 0;
+            Core::OptionalType<Core::JSON::Error> error;
+
+            while (handled < text.length()) {
+                const uint16_t size = std::min(static_cast<uint16_t>(text.length() - handled), chunk);
+                const uint16_t loaded = static_cast<Core::JSON::IElement&>(data).Deserialize(&(text[handled]), size, offset, error);
+                handled += loaded;
+                if ((offset == 0) || (loaded < size)) {
+                    break;
+                }
+            }
+
+            EXPECT_FALSE(error.IsSet());
+            EXPECT_STREQ(data.Label.Value().c_str(), reference.Label.Value().c_str());
+            EXPECT_STREQ(data.Opaque.Value().c_str(), reference.Opaque.Value().c_str());
+        }
+    }
+
+    TEST(JSONParser, ToStringGrowing)
+    {
+        Core::JSON::ArrayType<Core::JSON::String> list;
+        string expected(_T("["));
+
+        // Well over the 64KB a single Serialize call can take.
+        for (uint16_t index = 0; index < 5000; index++) {
+            const string entry(_T("entry number ") + Core::NumberType<uint16_t>(index).Text());
+            list.Add() = entry;
+            expected += (index == 0 ? _T("\"") : _T(",\"")) + entry + _T("\"");
+        }
+        expected += _T("]");
+
+        string text;
+        EXPECT_TRUE(list.ToString(text));
+        EXPECT_EQ(text, expected);
+
+        // A text that is reused, is written in place.
+        const size_t capacity = text.capacity();
+        list.Clear();
+        list.Add() = _T("short");
+        EXPECT_TRUE(list.ToString(text));
+        EXPECT_STREQ(text.c_str(), _T("[\"short\"]"));
+        EXPECT_EQ(text.capacity(), capacity);
+
+        // Taking over a serialized text, does not copy it.
+        Core::JSON::String result(false);
+        const TCHAR* data = text.c_str();
+        result = std::move(text);
+        EXPECT_EQ(result.Opaque().c_str(), data);
+    }
+
+    TEST(JSONParser, JSONRPCPooledParameters)
+    {
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const Core::ProxyType<Core::JSONRPC::Notification::Body>&) {}, { 1 });
+        const ParamsInfo* previous = nullptr;
+        bool reused = false;
+        bool null = false;
+
+        handler.Register<ParamsInfo, ParamsInfo>(_T("scan"), [&](const ParamsInfo& parameters, ParamsInfo& result) -> uint32_t {
+            reused = (&parameters == previous);
+            previous = &parameters;
+            null = parameters.IsNull();
+            if (parameters.Ssid.IsSet() == true) {
+                result.Ssid = parameters.Ssid.Value();
+            }
+            return (Core::ERROR_NONE);
+        });
+
+        string response;
+
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), _T("scan"), _T("{\"ssid\":\"Thunder\"}"), response), Core::ERROR_NONE);
+        EXPECT_STREQ(response.c_str(), _T("{\"ssid\":\"Thunder\"}"));
+
+        // The same objects are used again, but nothing of the previous call is left in there.
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), _T("scan"), _T("{}"), response), Core::ERROR_NONE);
+        EXPECT_TRUE(reused);
+        EXPECT_STREQ(response.c_str(), _T("{}"));
+
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), _T("scan"), _T("null"), response), Core::ERROR_NONE);
+        EXPECT_TRUE(null);
+        EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), _T("scan"), _T("{\"ssid\":\"Other\"}"), response), Core::ERROR_NONE);
+        EXPECT_FALSE(null);
+        EXPECT_STREQ(response.c_str(), _T("{\"ssid\":\"Other\"}"));
+    }
+
+    TEST(JSONParser, ArrayStableReferences)
+    {
+        Core::JSON::ArrayType<Core::JSON::DecUInt32> array;
+        std::vector<Core::JSON::DecUInt32*> references;
+
+        // An iterator taken before there was any storage, sees what got added since.
+        Core::JSON::ArrayType<Core::JSON::DecUInt32>::Iterator early(array.Elements());
+        array.Add() = 42;
+        EXPECT_TRUE(early.Next());
+        EXPECT_EQ(early.Current().Value(), 42u);
+        EXPECT_FALSE(early.Next());
+        array.Clear();
+
+        // Whatever is added later on, the elements added before stay where they are.
+        for (uint32_t index = 0; index < 1000; index++) {
+            Core::JSON::DecUInt32& element(array.Add());
+            element = index;
+            references.push_back(&element);
+        }
+
+        EXPECT_EQ(array.Length(), 1000);
+
+        for (uint32_t index = 0; index < 1000; index++) {
+            EXPECT_EQ(&(array[index]), references[index]);
+            EXPECT_EQ(references[index]->Value(), index);
+        }
+
+        uint32_t count = 0;
+        Core::JSON::ArrayType<Core::JSON::DecUInt32>::Iterator iterator(array.Elements());
+        while (iterator.Next() == true) {
+            EXPECT_EQ(&(iterator.Current()), references[count]);
+            count++;
+        }
+        EXPECT_EQ(count, 1000u);
+
+        Core::JSON::ArrayType<Core::JSON::DecUInt32> copy(array);
+        EXPECT_EQ(copy.Length(), 1000);
+        EXPECT_EQ(copy[999].Value(), 999u);
+
+        string text;
+        array.Clear();
+        array.FromString(_T("[1,2,3]"));
+        EXPECT_EQ(array.Length(), 3);
+        EXPECT_EQ(array.Get(2).Value(), 3u);
+        array.ToString(text);
+        EXPECT_STREQ(text.c_str(), _T("[1,2,3]"));
+
+        copy = array;
+        EXPECT_EQ(copy.Length(), 3);
+        copy.ToString(text);
+        EXPECT_STREQ(text.c_str(), _T("[1,2,3]"));
+    }
+
+    TEST(JSONParser, MessagePackTranscoding)
+    {
+        const TCHAR* texts[] = {
+            _T("{\"a\":[1,-2,-200,-70000,3.5,true,false,null],\"b\":\"x\\\"y\\\\z\\n\xC3\xA9\",\"c\":{},\"d\":[]}"),
+            _T("{\"e\":18446744073709551615,\"f\":-9223372036854775808,\"g\":{\"h\":[[],[{}]]}}"),
+            _T("[]"),
+            _T("\"\""),
+            _T("-1"),
+            _T("1.25")
+        };
+
+        for (const TCHAR* text : texts) {
+            std::vector<uint8_t> packed;
+            string result;
+
+            EXPECT_TRUE(Core::JSON::MessagePack::FromText(text, packed));
+            EXPECT_EQ(Core::JSON::MessagePack::Length(packed.data(), static_cast<uint32_t>(packed.size())), packed.size());
+            EXPECT_EQ(Core::JSON::MessagePack::Length(packed.data(), static_cast<uint32_t>(packed.size() - 1)), 0u);
+            EXPECT_TRUE(Core::JSON::MessagePack::ToText(packed.data(), static_cast<uint32_t>(packed.size()), result));
+            EXPECT_STREQ(result.c_str(), text);
+        }
+
+        // Escapes are resolved on the way in, unicode ends up as UTF-8.
+        std::vector<uint8_t> packed;
+        string result;
+        EXPECT_TRUE(Core::JSON::MessagePack::FromText(_T("\"\\u00e9\\ud83d\\ude00\""), packed));
+        EXPECT_TRUE(Core::JSON::MessagePack::ToText(packed.data(), static_cast<uint32_t>(packed.size()), result));
+        EXPECT_STREQ(result.c_str(), _T("\"\xC3\xA9\xF0\x9F\x98\x80\""));
+
+        packed.clear();
+        EXPECT_FALSE(Core::JSON::MessagePack::FromText(_T("{\"a\":}"), packed));
+        packed.clear();
+        EXPECT_FALSE(Core::JSON::MessagePack::FromText(_T("[1,2] 3"), packed));
+    }
+
+    TEST(JSONParser, MessagePackNumbers)
+    {
+        const int32_t values[] = { 0, -1, -32, -33, -129, -32601, 127, 128, 65536, INT32_MIN, INT32_MAX };
+        const size_t sizes[] = { 1, 1, 1, 2, 3, 3, 1, 2, 5, 5, 5 };
+
+        for (uint8_t index = 0; index < (sizeof(values) / sizeof(values[0])); index++) {
+            Core::JSON::DecSInt32 number;
+            Core::JSON::DecSInt32 result;
+            std::vector<uint8_t> buffer;
+
+            number = values[index];
+            number.ToBuffer(buffer);
+            EXPECT_EQ(buffer.size(), sizes[index]);
+            EXPECT_TRUE(result.FromBuffer(buffer));
+            EXPECT_TRUE(result.IsSet());
+            EXPECT_EQ(result.Value(), values[index]);
+        }
+
+        Core::JSON::DecUInt64 number;
+        Core::JSON::DecUInt64 result;
+        std::vector<uint8_t> buffer;
+
+        number = 0xFFFFFFFFFFFFFFFFULL;
+        number.ToBuffer(buffer);
+        EXPECT_EQ(buffer.size(), 9u);
+        EXPECT_TRUE(result.FromBuffer(buffer));
+        EXPECT_EQ(result.Value(), 0xFFFFFFFFFFFFFFFFULL);
+    }
+
+    TEST(JSONParser, MessagePackJSONRPC)
+    {
+        const TCHAR* texts[] = {
+            _T("{\"jsonrpc\":\"2.0\",\"id\":42,\"method\":\"Controller.1.status\",\"params\":{\"callsign\":\"Monitor\",\"depth\":[1,-2]}}"),
+            _T("{\"jsonrpc\":\"2.0\",\"id\":42,\"result\":[{\"state\":\"activated\"},null]}"),
+            _T("{\"jsonrpc\":\"2.0\",\"id\":42,\"error\":{\"code\":-32601,\"message\":\"Unknown method.\"}}")
+        };
+
+        for (const TCHAR* text : texts) {
+            Core::JSONRPC::Message message;
+            std::vector<uint8_t> buffer;
+
+            EXPECT_TRUE(message.FromString(text));
+            message.ToBuffer(buffer);
+
+            // Opaque parameters and results are sent as MessagePack themselves, not as an embedded string.
+            std::vector<uint8_t> expected;
+            EXPECT_TRUE(Core::JSON::MessagePack::FromText(text, expected));
+            EXPECT_EQ(buffer, expected);
+
+            // The way a channel hands it over, in small frames.
+            Core::JSONRPC::Message result;
+            uint32_t offset = 0;
+            uint32_t index = 0;
+            while (index < buffer.size()) {
+                const uint16_t size = static_cast<uint16_t>(std::min(static_cast<size_t>(5), buffer.size() - index));
+                index += static_cast<Core::JSON::IMessagePack&>(result).Deserialize(&(buffer[index]), size, offset);
+            }
+            EXPECT_EQ(offset, 0u);
+
+            string back;
+            result.ToString(back);
+            EXPECT_STREQ(back.c_str(), text);
+        }
+
+        Core::JSONRPC::Notification notification;
+        std::vector<uint8_t> buffer;
+        string back;
+
+        notification.Set(_T("client.events.statechange"), Core::ProxyType<Core::JSONRPC::Notification::Body>::Create(string(_T("{\"state\":\"Activated\",\"n\":-3}"))));
+        notification.ToBuffer(buffer);
+
+        Core::JSONRPC::Message message;
+        EXPECT_TRUE(message.FromBuffer(buffer));
+        message.ToString(back);
+        EXPECT_STREQ(back.c_str(), _T("{\"jsonrpc\":\"2.0\",\"method\":\"client.events.statechange\",\"params\":{\"state\":\"Activated\",\"n\":-3}}"));
+
+        // Fields the receiver does not know are skipped, whatever their type.
+        ParamsInfo info;
+        buffer.clear();
+        EXPECT_TRUE(Core::JSON::MessagePack::FromText(_T("{\"unknown\":{\"a\":[1,{\"b\":2}]},\"ssid\":\"Thunder\"}"), buffer));
+        EXPECT_TRUE(info.FromBuffer(buffer));
+        EXPECT_STREQ(info.Ssid.Value().c_str(), _T("Thunder"));
+    }
 }
 }
@@ -0,0 +1,187 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <algorithm>
+#include <iostream>
+
+namespace WPEFramework {
+namespace Tests {
+
+    class EventParameters : public Core::JSON::Container {
+    public:
+        EventParameters(const EventParameters&) = delete;
+        EventParameters& operator=(const EventParameters&) = delete;
+
+        EventParameters()
+            : Core::JSON::Container()
+            , Callsign()
+            , State()
+            , Reason()
+            , Sequence()
+        {
+            Add(_T("callsign"), &Callsign);
+            Add(_T("state"), &State);
+            Add(_T("reason"), &Reason);
+            Add(_T("sequence"), &Sequence);
+        }
+        ~EventParameters() override = default;
+
+    public:
+        Core::JSON::String Callsign;
+        Core::JSON::String State;
+        Core::JSON::String Reason;
+        Core::JSON::DecUInt32 Sequence;
+    };
+
+    // What a channel does with an element it has to send: serialize it, in chunks, into its buffer.
+    static uint32_t Drain(const Core::JSON::IElement& element, const uint16_t chunk, string* text = nullptr)
+    {
+        char buffer[1024];
+        uint32_t offset = 0;
+        uint32_t total = 0;
+        uint16_t loaded;
+
+        ASSERT(chunk <= sizeof(buffer));
+
+        do {
+            loaded = element.Serialize(buffer, chunk, offset);
+            total += loaded;
+
+            if (text != nullptr) {
+                text->append(buffer, loaded);
+            }
+        } while (offset != 0);
+
+        return (total);
+    }
+
+    TEST(Core_NotifyBenchmark, SameMessage)
+    {
+        Core::JSONRPC::Message original;
+        Core::JSONRPC::Notification notification;
+        EventParameters parameters;
+        string subject;
+
+        parameters.Callsign = _T("WebKitBrowser");
+        parameters.State = _T("Activated");
+        parameters.Reason = _T("Requested \"by\" user");
+        parameters.Sequence = 42;
+        parameters.ToString(subject);
+
+        original.Designator = _T("client.events.statechange");
+        original.Parameters = subject;
+
+        notification.Set(_T("client.events.statechange"), Core::ProxyType<Core::JSONRPC::Notification::Body>::Create(subject));
+
+        // Whatever the chunk size of the channel, the text should be the same as that of a message.
+        for (const uint16_t chunk : { 1, 7, 64, 1024 }) {
+            string expected, actual;
+
+            Drain(original, chunk, &expected);
+            Drain(notification, chunk, &actual);
+
+            EXPECT_EQ(expected, actual);
+        }
+
+        // Without parameters..
+        string expected, actual;
+
+        original.Parameters.Clear();
+        original.ToString(expected);
+        notification.Set(_T("client.events.statechange"), Core::ProxyType<Core::JSONRPC::Notification::Body>::Create(EMPTY_STRING));
+        notification.ToString(actual);
+
+        EXPECT_EQ(expected, actual);
+    }
+
+    static void NotifyThroughput(const uint32_t subscribers, const uint32_t notifications)
+    {
+        std::vector<uint8_t> versions = { 1 };
+        const uint32_t events = std::max(notifications / subscribers, static_cast<uint32_t>(1));
+
+        EventParameters parameters;
+        string subject;
+        uint64_t sharedBytes = 0;
+        uint64_t copiedBytes = 0;
+
+        parameters.Callsign = _T("WebKitBrowser");
+        parameters.State = _T("Activated");
+        parameters.Reason = _T("Requested by user");
+        parameters.ToString(subject);
+
+        // Serialize once: the observers share the rendered body.
+        Core::JSONRPC::Handler shared([&](const uint32_t, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>& body) {
+            Core::ProxyType<Core::JSONRPC::Notification> message(Core::ProxyType<Core::JSONRPC::Notification>::Create());
+            message->Set(designator, body);
+            sharedBytes += Drain(*message, 1024);
+        }, versions);
+
+        // Reference: a message per observer, carrying its own copy of the parameters.
+        Core::JSONRPC::Handler copied([&](const uint32_t, const string& designator, const Core::ProxyType<Core::JSONRPC::Notification::Body>&) {
+            Core::ProxyType<Core::JSONRPC::Message> message(Core::ProxyType<Core::JSONRPC::Message>::Create());
+            message->JSONRPC = Core::JSONRPC::Message::DefaultVersion;
+            message->Designator = designator;
+            message->Parameters = subject;
+            copiedBytes += Drain(*message, 1024);
+        }, versions);
+
+        for (uint32_t index = 0; index < subscribers; ++index) {
+            Core::JSONRPC::Message response;
+            shared.Subscribe(index + 1, _T("statechange"), _T("client.events"), response);
+            copied.Subscribe(index + 1, _T("statechange"), _T("client.events"), response);
+        }
+
+        uint64_t start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < events; ++index) {
+            parameters.Sequence = index;
+            parameters.ToString(subject);
+            shared.Notify(_T("statechange"), parameters);
+        }
+        uint64_t sharedTime = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < events; ++index) {
+            parameters.Sequence = index;
+            parameters.ToString(subject);
+            copied.Notify(_T("statechange"), parameters);
+        }
+        uint64_t copiedTime = Core::Time::Now().Ticks();
+
+        EXPECT_EQ(sharedBytes, copiedBytes);
+
+        auto rate = [](const uint64_t count, const uint64_t ticks) -> uint64_t {
+            return ((count * Core::Time::TicksPerMillisecond * 1000) / std::max(ticks, static_cast<uint64_t>(1)));
+        };
+
+        const uint64_t sent = static_cast<uint64_t>(events) * subscribers;
+
+        std::cout << "Notify [" << subscribers << " subscribers]: serialize once " << rate(sent, sharedTime - start)
+                  << " notifications/s, per subscriber " << rate(sent, copiedTime - sharedTime) << " notifications/s" << std::endl;
+    }
+
+    TEST(Core_NotifyBenchmark, Throughput)
+    {
+        for (const uint32_t subscribers : { 1, 10, 50, 200 }) {
+            NotifyThroughput(subscribers, 100000);
+        }
+    }
+} // Tests
+} // WPEFramework
@@ -0,0 +1,242 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <algorithm>
+#include <iostream>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // The labels the JsonGenerator produces for the methods of Tests/jsongenerator/IJsonGeneratorCorpus.h
+    static const TCHAR* const CorpusLabels[] = {
+        _T("methodsinglefundmentalin"), _T("methodsinglefundmentalout"), _T("methodsinglefundmentalinout"),
+        _T("methodsinglestringin"), _T("methodsinglestringout"), _T("methodsinglestringinout"),
+        _T("methodsingleenumin"), _T("methodsingleenumout"), _T("methodsingleenuminout"),
+        _T("methodsinglebufferinsizeafter"), _T("methodsinglebufferoutsizeafter"), _T("methodsinglebufferinoutsizeafter"),
+        _T("methodsinglebufferinsizebefore"), _T("methodsinglebufferoutsizebefore"), _T("methodsinglebufferinoutsizebefore"),
+        _T("methodsinglebufferinsizebeforeinout"), _T("methodsinglebufferoutsizebeforeinout"), _T("methodsinglebufferinoutsizebeforeinout"),
+        _T("methodsinglestringiteratorin"), _T("methodsinglestringiteratorout"),
+        _T("methodsinglevalueiteratorin"), _T("methodsinglevalueiteratorout"),
+        _T("methodsingleenumiteratorin"), _T("methodsingleenumiteratorout"),
+        _T("methodsinglecompounditeratorin"), _T("methodsinglecompounditeratorout"),
+        _T("methodsinglecompoundin"), _T("methodsinglecompoundout"), _T("methodsinglecompoundinout"),
+        _T("methodsinglenestedcompoundin"), _T("methodsinglenestedcompoundout"), _T("methodsinglenestedcompoundinout"),
+        _T("methodmultiplefundmentalin"), _T("methodmultiplefundmentalout"), _T("methodmultiplefundmentalinout"),
+        _T("methodmultiplefundmentalinandout"), _T("methodmultiplefundmentaloutandin"), _T("methodmultiplefundmentalinandinout"),
+        _T("methodmultiplefundmentaloutandinout"), _T("methodmultiplecompoundin"), _T("methodmultiplecompoundout"),
+        _T("methodmultiplecompoundinout"), _T("methodmultiplecompoundinandout"), _T("methodmultiplecompoundoutandin"),
+        _T("methodmultiplecompoundinandinout"), _T("methodmultiplecompoundoutandinout"), _T("propertyfundmentalreadonly"),
+        _T("propertyfundmentalwriteonly")
+    };
+
+    template <uint16_t MEMBERS>
+    class CorpusData : public Core::JSON::Container {
+    public:
+        static_assert(MEMBERS <= (sizeof(CorpusLabels) / sizeof(CorpusLabels[0])), "Not that many labels in the corpus");
+
+        CorpusData(const CorpusData&) = delete;
+        CorpusData& operator=(const CorpusData&) = delete;
+
+        CorpusData()
+            : Core::JSON::Container()
+        {
+            for (uint16_t index = 0; index < MEMBERS; index++) {
+                Add(CorpusLabels[index], &Values[index]);
+            }
+        }
+        ~CorpusData() override = default;
+
+    public:
+        Core::JSON::DecUInt32 Values[MEMBERS];
+    };
+
+    // Keys in reverse declaration order, the worst case for a walk over the members.
+    static string CorpusText(const uint16_t members)
+    {
+        string text(_T("{"));
+
+        for (uint16_t index = members; index > 0; index--) {
+            text += (index != members ? _T(",\"") : _T("\""));
+            text += CorpusLabels[index - 1];
+            text += _T("\":");
+            text += Core::NumberType<uint16_t>(index - 1).Text();
+        }
+
+        return (text + _T("}"));
+    }
+
+    template <uint16_t MEMBERS>
+    static uint64_t CorpusParse(const uint32_t rounds)
+    {
+        const string text(CorpusText(MEMBERS));
+        CorpusData<MEMBERS> data;
+        Core::OptionalType<Core::JSON::Error> error;
+
+        uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint32_t round = 0; round < rounds; round++) {
+            data.Clear();
+            data.FromString(text, error);
+        }
+
+        uint64_t duration = Core::Time::Now().Ticks() - start;
+
+        EXPECT_FALSE(error.IsSet());
+
+        for (uint16_t index = 0; index < MEMBERS; index++) {
+            EXPECT_EQ(data.Values[index].Value(), index);
+        }
+
+        // Nanoseconds per key.
+        return ((duration * 1000 * 1000) / (static_cast<uint64_t>(Core::Time::TicksPerMillisecond) * rounds * MEMBERS));
+    }
+
+    TEST(Core_ParserBenchmark, Labels)
+    {
+        const uint64_t narrow = CorpusParse<4>(20000);
+        const uint64_t medium = CorpusParse<16>(5000);
+        const uint64_t wide = CorpusParse<48>(2000);
+
+        std::cout << "Deserialize per key: 4 members " << narrow << " ns, 16 members " << medium << " ns, 48 members " << wide << " ns" << std::endl;
+    }
+
+    TEST(Core_ParserBenchmark, Strings)
+    {
+        // Pretty printed, with long strings and an opaque object: the bulk of the text needs no attention.
+        class Data : public Core::JSON::Container {
+        public:
+            Data()
+                : Core::JSON::Container()
+                , Description()
+                , Parameters(false)
+            {
+                Add(_T("description"), &Description);
+                Add(_T("parameters"), &Parameters);
+            }
+
+        public:
+            Core::JSON::String Description;
+            Core::JSON::String Parameters;
+        };
+
+        const string description(512, 'x');
+        const string text(_T("{\n        \"description\"  :  \"") + description + _T("\",\n        \"parameters\" : {\n            \"url\" : \"")
+            + description + _T("\",\n            \"list\" : [ 1, 2, 3 ]\n        }\n}"));
+        const uint32_t rounds = 20000;
+
+        Data data;
+        Core::OptionalType<Core::JSON::Error> error;
+
+        uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint32_t round = 0; round < rounds; round++) {
+            data.Clear();
+            data.FromString(text, error);
+        }
+
+        uint64_t duration = std::max(Core::Time::Now().Ticks() - start, static_cast<uint64_t>(1));
+
+        EXPECT_FALSE(error.IsSet());
+        EXPECT_EQ(data.Description.Value(), description);
+
+        std::cout << "Deserialize strings: " << ((static_cast<uint64_t>(text.length()) * rounds * Core::Time::TicksPerMillisecond) / duration) << " KB/s" << std::endl;
+    }
+
+    class ArrayEntry : public Core::JSON::Container {
+    public:
+        ArrayEntry()
+            : Core::JSON::Container()
+            , Id()
+            , Name()
+        {
+            Add(_T("id"), &Id);
+            Add(_T("name"), &Name);
+        }
+        ArrayEntry(const ArrayEntry& copy)
+            : Core::JSON::Container()
+            , Id(copy.Id)
+            , Name(copy.Name)
+        {
+            Add(_T("id"), &Id);
+            Add(_T("name"), &Name);
+        }
+        ~ArrayEntry() override = default;
+
+        ArrayEntry& operator=(const ArrayEntry&) = delete;
+
+    public:
+        Core::JSON::DecUInt32 Id;
+        Core::JSON::String Name;
+    };
+
+    template <typename ELEMENT>
+    static void ArrayRoundTrip(const char name[], const string& text, const uint32_t rounds)
+    {
+        Core::JSON::ArrayType<ELEMENT> data;
+        Core::OptionalType<Core::JSON::Error> error;
+        string result;
+
+        uint64_t start = Core::Time::Now().Ticks();
+
+        for (uint32_t round = 0; round < rounds; round++) {
+            data.Clear();
+            data.FromString(text, error);
+        }
+
+        uint64_t parsed = Core::Time::Now().Ticks();
+
+        for (uint32_t round = 0; round < rounds; round++) {
+            data.ToString(result);
+        }
+
+        uint64_t serialized = Core::Time::Now().Ticks();
+
+        EXPECT_FALSE(error.IsSet());
+        EXPECT_EQ(result, text);
+
+        // Microseconds per array.
+        std::cout << "Array of " << data.Length() << ' ' << name << ": deserialize " << (((parsed - start) * 1000) / (static_cast<uint64_t>(Core::Time::TicksPerMillisecond) * rounds))
+                  << " us, serialize " << (((serialized - parsed) * 1000) / (static_cast<uint64_t>(Core::Time::TicksPerMillisecond) * rounds)) << " us" << std::endl;
+    }
+
+    TEST(Core_ParserBenchmark, Arrays)
+    {
+        const uint16_t elements = 10000;
+        string numbers(_T("["));
+        string entries(_T("["));
+
+        for (uint16_t index = 0; index < elements; index++) {
+            const string id(Core::NumberType<uint16_t>(index).Text());
+
+            numbers += (index != 0 ? _T(",") : _T("")) + id;
+            entries += (index != 0 ? _T(",{\"id\":") : _T("{\"id\":")) + id + _T(",\"name\":\"thread") + id + _T("\"}");
+        }
+        numbers += _T("]");
+        entries += _T("]");
+
+        ArrayRoundTrip<Core::JSON::DecUInt32>("numbers", numbers, 50);
+        ArrayRoundTrip<ArrayEntry>("objects", entries, 10);
+    }
+
+} // Tests
+} // WPEFramework
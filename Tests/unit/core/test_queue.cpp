@@ -21,6 +21,7 @@
 
 #include <gtest/gtest.h>
 #include <core/core.h>
+#include <thread>
 
 using namespace WPEFramework;
 using namespace WPEFramework::Core;
@@ -39,3 +40,118 @@ TEST(test_queue, simple_queue)
     obj1.Disable();
     obj1.Flush();
 }
+
+template <typename QUEUE>
+static uint64_t QueueThroughput(const uint8_t producers, const uint8_t consumers, const uint32_t entries)
+{
+    QUEUE queue(1024);
+    std::atomic<uint32_t> consumed(0);
+    std::vector<std::thread> threads;
+
+    const uint64_t start = Core::Time::Now().Ticks();
+
+    for (uint8_t index = 0; index < consumers; ++index) {
+        threads.emplace_back([&queue, &consumed]() {
+            uint32_t entry;
+            while (queue.Extract(entry, Core::infinite) == true) {
+                consumed++;
+            }
+        });
+    }
+    for (uint8_t index = 0; index < producers; ++index) {
+        threads.emplace_back([&queue, entries]() {
+            for (uint32_t entry = 0; entry < entries; ++entry) {
+                queue.Insert(entry, Core::infinite);
+            }
+        });
+    }
+
+    const uint32_t total = producers * entries;
+    while (consumed.load() < total) {
+        std::this_thread::yield();
+    }
+
+    const uint64_t duration = Core::Time::Now().Ticks() - start;
+
+    queue.Disable();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(consumed.load(), total);
+
+    return ((static_cast<uint64_t>(total) * Core::Time::TicksPerMillisecond * 1000) / std::max(duration, static_cast<uint64_t>(1)));
+}
+
+#if defined(__LINUX__) && !defined(__APPLE__)
+TEST(test_queue, lockfree_queue)
+{
+    LockFreeQueueType<int> obj1(20);
+    EXPECT_EQ(obj1.Slots(), 32u);
+    EXPECT_TRUE(obj1.Insert(20,300));
+    EXPECT_TRUE(obj1.Insert(30,300));
+    EXPECT_TRUE(obj1.Post(20));
+    EXPECT_TRUE(obj1.HasEntry(30));
+    EXPECT_TRUE(obj1.Remove(20));
+    int a_Result = 0;
+    EXPECT_TRUE(obj1.Extract(a_Result,300));
+    EXPECT_EQ(a_Result, 30);
+    EXPECT_EQ(obj1.Length(),1u);
+    EXPECT_TRUE(obj1.Extract(a_Result,300));
+    EXPECT_EQ(a_Result, 20);
+    EXPECT_FALSE(obj1.Extract(a_Result,0));
+    obj1.Enable();
+    obj1.Disable();
+    obj1.Flush();
+}
+
+TEST(test_queue, lockfree_queue_overflow)
+{
+    LockFreeQueueType<int> obj1(4);
+
+    for (int index = 0; index < 4; ++index) {
+        EXPECT_TRUE(obj1.Insert(index, 0));
+    }
+
+    // The ring is full, Insert times out but Post still succeeds.
+    EXPECT_TRUE(obj1.IsFull());
+    EXPECT_FALSE(obj1.Insert(4, 50));
+    EXPECT_TRUE(obj1.Post(4));
+    EXPECT_TRUE(obj1.Post(5));
+    EXPECT_EQ(obj1.Length(), 6u);
+    EXPECT_TRUE(obj1.Remove(1));
+    EXPECT_TRUE(obj1.Remove(5));
+    EXPECT_FALSE(obj1.Remove(5));
+
+    int a_Result = 0;
+    for (int expected : { 0, 2, 3, 4 }) {
+        EXPECT_TRUE(obj1.Extract(a_Result, 0));
+        EXPECT_EQ(a_Result, expected);
+    }
+    EXPECT_TRUE(obj1.IsEmpty());
+
+    // A Disable() releases a waiting consumer.
+    std::thread consumer([&obj1]() {
+        int entry;
+        EXPECT_FALSE(obj1.Extract(entry, Core::infinite));
+    });
+    SleepMs(50);
+    obj1.Disable();
+    consumer.join();
+    obj1.Flush();
+}
+
+TEST(test_queue, lockfree_queue_throughput)
+{
+    const uint32_t entries = 250000;
+
+    for (uint8_t threads : { 1, 4 }) {
+        uint64_t locked = QueueThroughput<QueueType<uint32_t>>(threads, threads, entries);
+        uint64_t lockfree = QueueThroughput<LockFreeQueueType<uint32_t>>(threads, threads, entries);
+
+        std::cout << static_cast<uint32_t>(threads) << " producer(s)/" << static_cast<uint32_t>(threads) << " consumer(s): QueueType "
+                  << locked << " jobs/s, LockFreeQueueType " << lockfree << " jobs/s" << std::endl;
+    }
+}
+#endif
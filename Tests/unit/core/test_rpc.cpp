@@ -24,6 +24,7 @@
 #include <core/core.h>
 #include <com/com.h>
 #include <core/Portability.h>
+#include <iostream>
 
 namespace WPEFramework {
 namespace Exchange {
@@ -290,6 +291,16 @@ namespace Tests {
           adder->Add(22);
           EXPECT_EQ(adder->GetValue(), static_cast<uint32_t>(42));
 
+          // The messages and their frames are pooled, so once warmed up, calls do not allocate frames.
+          Core::FrameStatistics::Reset();
+
+          for (uint32_t index = 0; index < 100; ++index) {
+              adder->Add(1);
+          }
+          EXPECT_EQ(adder->GetValue(), static_cast<uint32_t>(142));
+          EXPECT_EQ(Core::FrameStatistics::Allocations(), 0u);
+          EXPECT_EQ(Core::FrameStatistics::Reallocations(), 0u);
+
           // Make sure other side is indeed running in other process.
           EXPECT_NE(adder->GetPid(), (uint32_t)getpid());
 
@@ -301,5 +312,153 @@ namespace Tests {
        testAdmin.Sync("done testing");
        Core::Singleton::Dispose();
     }
+
+    static uint32_t Segments()
+    {
+        const string filter(_T("comrpc.") + Core::NumberType<uint32_t>(static_cast<uint32_t>(Core::ProcessInfo().Id())).Text() + _T(".*"));
+        Core::Directory directory(_T("/tmp"), filter.c_str());
+        uint32_t count = 0;
+
+        while (directory.Next() == true) {
+            count++;
+        }
+
+        return (count);
+    }
+
+    TEST(Core_RPC, BulkBuffer)
+    {
+        // More than a frame could ever carry before.
+        std::vector<uint8_t> large(1024 * 1024);
+        const uint8_t small[] = { 1, 2, 3, 4 };
+
+        for (uint32_t index = 0; index < large.size(); ++index) {
+            large[index] = static_cast<uint8_t>(index * 7);
+        }
+
+        RPC::Data::Input sent;
+        RPC::Data::Input received;
+
+        sent.Set(0, Exchange::IAdder::ID, 1);
+
+        RPC::Data::Frame::Writer writer(sent.Writer());
+        writer.Buffer<uint32_t>(static_cast<uint32_t>(large.size()), large.data());
+        writer.Buffer<uint16_t>(sizeof(small), small);
+        writer.Number<uint32_t>(42);
+
+        // Only the name of the large buffer travels in the frame.
+        EXPECT_LT(sent.Length(), RPC::Data::IPC_BULK_SIZE);
+        EXPECT_EQ(Segments(), 1u);
+
+        // Like the channel does, in chunks.
+        uint8_t chunk[64];
+        uint32_t offset = 0;
+
+        while (offset < sent.Length()) {
+            const uint16_t loaded = sent.Serialize(chunk, sizeof(chunk), offset);
+            received.Deserialize(chunk, loaded, offset);
+            offset += loaded;
+        }
+
+        RPC::Data::Frame::Reader reader(received.Reader());
+        const uint8_t* buffer = nullptr;
+
+        const uint32_t length = reader.LockBuffer<uint32_t>(buffer);
+        ASSERT_EQ(length, large.size());
+        ASSERT_NE(buffer, nullptr);
+        EXPECT_EQ(::memcmp(buffer, large.data(), length), 0);
+        reader.UnlockBuffer(length);
+
+        // Taken over, so it is no longer visible, but still mapped until the frame is cleared.
+        EXPECT_EQ(Segments(), 0u);
+
+        uint8_t copy[sizeof(small)];
+        EXPECT_EQ(reader.Buffer<uint16_t>(sizeof(copy), copy), sizeof(small));
+        EXPECT_EQ(::memcmp(copy, small, sizeof(small)), 0);
+        EXPECT_EQ(reader.Number<uint32_t>(), 42u);
+
+        received.Clear();
+        sent.Clear();
+
+        // Parameters the other side never took over, are removed once the call is cleared.
+        RPC::Data::Input abandoned;
+        RPC::Data::Frame::Writer other(abandoned.Writer());
+        other.Buffer<uint32_t>(static_cast<uint32_t>(large.size()), large.data());
+        EXPECT_EQ(Segments(), 1u);
+        abandoned.Clear();
+        EXPECT_EQ(Segments(), 0u);
+
+        // Read by copying it out, as the proxies do with output buffers.
+        RPC::Data::Output response;
+        RPC::Data::Frame::Writer output(response.Writer());
+        output.Buffer<uint32_t>(static_cast<uint32_t>(large.size()), large.data());
+
+        std::vector<uint8_t> result(large.size());
+        RPC::Data::Frame::Reader input(response.Reader());
+        EXPECT_EQ(input.Buffer<uint32_t>(static_cast<uint32_t>(result.size()), result.data()), large.size());
+        EXPECT_EQ(result, large);
+        EXPECT_EQ(Segments(), 0u);
+    }
+    TEST(Core_RPC, ProxyIndex)
+    {
+        // The channel only identifies the proxies and references in the administration, it is never opened.
+        Core::ProxyType<RPC::CommunicatorClient> client = Core::ProxyType<RPC::CommunicatorClient>::Create(Core::NodeId(_T("/tmp/wperpc02")));
+        Core::ProxyType<Core::IPCChannel> channel(client);
+        RPC::Administrator& administrator(RPC::Administrator::Instance());
+
+        const uint32_t count = 1000;
+        std::vector<Exchange::IAdder*> proxies(count, nullptr);
+
+        // Inbound proxies, so releasing them does not have to reach the other side.
+        for (uint32_t index = 0; index < count; ++index) {
+            administrator.ProxyInstance<Exchange::IAdder>(channel, index + 1, false, proxies[index]);
+            ASSERT_NE(proxies[index], nullptr);
+        }
+
+        Exchange::IAdder* again = nullptr;
+        administrator.ProxyInstance<Exchange::IAdder>(channel, count, false, again);
+        EXPECT_EQ(again, proxies[count - 1]);
+        again->Release();
+
+        const uint64_t start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < count; ++index) {
+            Exchange::IAdder* found = administrator.ProxyFind<Exchange::IAdder>(channel, index + 1);
+            EXPECT_EQ(found, proxies[index]);
+            found->Release();
+        }
+        const uint64_t ticks = std::max(Core::Time::Now().Ticks() - start, static_cast<uint64_t>(1));
+
+        std::cout << "ProxyFind [" << count << " proxies]: " << ((count * Core::Time::TicksPerMillisecond * 1000) / ticks) << " lookups/s" << std::endl;
+
+        for (uint32_t index = 0; index < count; ++index) {
+            EXPECT_EQ(proxies[index]->Release(), Core::ERROR_DESTRUCTION_SUCCEEDED);
+        }
+        EXPECT_EQ(administrator.ProxyFind<Exchange::IAdder>(channel, 1), nullptr);
+
+        // References handed out over the channel, as the stubs do on behalf of the other side.
+        std::vector<Exchange::IAdder*> adders(count, nullptr);
+
+        for (uint32_t index = 0; index < count; ++index) {
+            adders[index] = Core::Service<Adder>::Create<Exchange::IAdder>();
+            adders[index]->AddRef();
+            administrator.RegisterInterface(channel, adders[index]);
+        }
+        adders[0]->AddRef();
+        administrator.RegisterInterface(channel, adders[0]);
+
+        // The other side returns half of them..
+        for (uint32_t index = 0; index < count; index += 2) {
+            administrator.Release(channel, adders[index], Exchange::IAdder::ID, 1);
+        }
+
+        // .. and the rest is released on its behalf once the channel is gone.
+        std::list<ProxyStub::UnknownProxy*> pending;
+        administrator.DeleteChannel(channel, pending);
+        EXPECT_TRUE(pending.empty());
+
+        for (uint32_t index = 0; index < count; ++index) {
+            EXPECT_EQ(adders[index]->Release(), Core::ERROR_DESTRUCTION_SUCCEEDED);
+        }
+    }
 } // Tests
 } // WPEFramework
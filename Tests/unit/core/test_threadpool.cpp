@@ -1388,3 +1388,222 @@ TEST(Core_ThreadPool, CheckThreadPool_JobType_Reschedule_AfterIdle)
     jobs.clear();
 }
 
+
+class CountingJob : public Core::IDispatch {
+public:
+    CountingJob() = delete;
+    CountingJob(const CountingJob&) = delete;
+    CountingJob& operator=(const CountingJob&) = delete;
+    CountingJob(std::atomic<uint32_t>& counter)
+        : _counter(counter)
+    {
+    }
+    ~CountingJob() override = default;
+
+public:
+    void Dispatch() override
+    {
+        _counter++;
+    }
+
+private:
+    std::atomic<uint32_t>& _counter;
+};
+
+class FanOutJob : public Core::IDispatch {
+public:
+    FanOutJob() = delete;
+    FanOutJob(const FanOutJob&) = delete;
+    FanOutJob& operator=(const FanOutJob&) = delete;
+    FanOutJob(ThreadPool& threadPool, std::atomic<uint32_t>& counter, const uint32_t children, const bool revoke)
+        : _threadPool(threadPool)
+        , _counter(counter)
+        , _children(children)
+        , _revoke(revoke)
+        , _revoked(0)
+        , _done(false, true)
+    {
+    }
+    ~FanOutJob() override = default;
+
+public:
+    void Dispatch() override
+    {
+        for (uint32_t index = 0; index < _children; ++index) {
+            Core::ProxyType<Core::IDispatch> child(Core::ProxyType<CountingJob>::Create(_counter));
+
+            _threadPool.Submit(child, Core::infinite);
+
+            if ((_revoke == true) && (_threadPool.Revoke(child, 0) == Core::ERROR_NONE)) {
+                _revoked++;
+            }
+        }
+        _done.SetEvent();
+    }
+    uint32_t Revoked() const
+    {
+        return (_revoked);
+    }
+    uint32_t WaitForDone(const uint32_t waitTime)
+    {
+        return (_done.Lock(waitTime));
+    }
+
+private:
+    ThreadPool& _threadPool;
+    std::atomic<uint32_t>& _counter;
+    uint32_t _children;
+    bool _revoke;
+    uint32_t _revoked;
+    Event _done;
+};
+
+TEST(Core_ThreadPool, CheckThreadPool_SubmitFromWorker)
+{
+    constexpr uint32_t children = 500;
+    std::atomic<uint32_t> counter(0);
+    Dispatcher dispatcher;
+    ThreadPool threadPool(4, 0, 16, &dispatcher, nullptr);
+
+    threadPool.Run();
+
+    Core::ProxyType<FanOutJob> parent(Core::ProxyType<FanOutJob>::Create(threadPool, counter, children, false));
+    threadPool.Submit(Core::ProxyType<Core::IDispatch>(parent), Core::infinite);
+
+    EXPECT_EQ(parent->WaitForDone(MaxJobWaitTime * 5), Core::ERROR_NONE);
+
+    // All jobs submitted by the worker should complete, whoever picks them up.
+    for (uint32_t waited = 0; (counter.load() < children) && (waited < (MaxJobWaitTime * 5)); waited += 10) {
+        SleepMs(10);
+    }
+    EXPECT_EQ(counter.load(), children);
+    EXPECT_EQ(threadPool.Pending(), 0u);
+
+    threadPool.Stop();
+    parent.Release();
+}
+
+TEST(Core_ThreadPool, CheckThreadPool_RevokeJobSubmittedFromWorker)
+{
+    constexpr uint32_t children = 50;
+    std::atomic<uint32_t> counter(0);
+    Dispatcher dispatcher;
+    ThreadPool threadPool(1, 0, 64, &dispatcher, nullptr);
+
+    threadPool.Run();
+
+    Core::ProxyType<FanOutJob> parent(Core::ProxyType<FanOutJob>::Create(threadPool, counter, children, true));
+    threadPool.Submit(Core::ProxyType<Core::IDispatch>(parent), Core::infinite);
+
+    EXPECT_EQ(parent->WaitForDone(MaxJobWaitTime * 5), Core::ERROR_NONE);
+    SleepMs(100);
+
+    // The only worker is busy submitting, so every child is still pending when it is revoked.
+    EXPECT_EQ(parent->Revoked(), children);
+    EXPECT_EQ(counter.load(), 0u);
+    EXPECT_EQ(threadPool.Pending(), 0u);
+
+    threadPool.Stop();
+    parent.Release();
+}
+
+class GateJob : public Core::IDispatch {
+public:
+    GateJob(const GateJob&) = delete;
+    GateJob& operator=(const GateJob&) = delete;
+    GateJob()
+        : _entered(false, true)
+        , _gate(false, true)
+    {
+    }
+    ~GateJob() override = default;
+
+public:
+    void Dispatch() override
+    {
+        _entered.SetEvent();
+        _gate.Lock(MaxJobWaitTime * 5);
+    }
+    uint32_t WaitForEntered(const uint32_t waitTime)
+    {
+        return (_entered.Lock(waitTime));
+    }
+    void Open()
+    {
+        _gate.SetEvent();
+    }
+
+private:
+    Event _entered;
+    Event _gate;
+};
+
+class OrderJob : public Core::IDispatch {
+public:
+    OrderJob() = delete;
+    OrderJob(const OrderJob&) = delete;
+    OrderJob& operator=(const OrderJob&) = delete;
+    OrderJob(string& order, const TCHAR tag)
+        : _order(order)
+        , _tag(tag)
+    {
+    }
+    ~OrderJob() override = default;
+
+public:
+    void Dispatch() override
+    {
+        // Only one minion in these tests, no need to lock.
+        _order += _tag;
+    }
+
+private:
+    string& _order;
+    TCHAR _tag;
+};
+
+TEST(Core_ThreadPool, CheckThreadPool_PriorityLanes)
+{
+    string order;
+    Dispatcher dispatcher;
+    ThreadPool threadPool(1, 0, 16, &dispatcher, nullptr);
+
+    threadPool.Run();
+
+    Core::ProxyType<GateJob> gate(Core::ProxyType<GateJob>::Create());
+    threadPool.Submit(Core::ProxyType<Core::IDispatch>(gate), Core::infinite);
+    EXPECT_EQ(gate->WaitForEntered(MaxJobWaitTime), Core::ERROR_NONE);
+
+    // The only minion is held at the gate, so all these queue up in their lanes.
+    threadPool.Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<OrderJob>::Create(order, 'b')), Core::infinite, ThreadPool::BULK);
+    threadPool.Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<OrderJob>::Create(order, 'n')), Core::infinite, ThreadPool::NORMAL);
+    threadPool.Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<OrderJob>::Create(order, 'B')), Core::infinite, ThreadPool::BULK);
+    threadPool.Submit(Core::ProxyType<Core::IDispatch>(Core::ProxyType<OrderJob>::Create(order, 'c')), Core::infinite, ThreadPool::CRITICAL);
+
+    ThreadPool::LaneMetadata lanes[ThreadPool::Priorities];
+    threadPool.Lanes(ThreadPool::Priorities, lanes);
+    EXPECT_EQ(lanes[ThreadPool::CRITICAL].Pending, 1u);
+    EXPECT_EQ(lanes[ThreadPool::NORMAL].Pending, 1u);
+    EXPECT_EQ(lanes[ThreadPool::BULK].Pending, 2u);
+    EXPECT_EQ(threadPool.Pending(), 4u);
+
+    gate->Open();
+
+    for (uint32_t waited = 0; (threadPool.Pending() > 0) && (waited < MaxJobWaitTime); waited += 10) {
+        SleepMs(10);
+    }
+    SleepMs(50);
+
+    EXPECT_EQ(order, string(_T("cnbB")));
+
+    threadPool.Lanes(ThreadPool::Priorities, lanes);
+    EXPECT_EQ(lanes[ThreadPool::CRITICAL].Lane, ThreadPool::CRITICAL);
+    EXPECT_EQ(lanes[ThreadPool::CRITICAL].Dispatched, 1u);
+    EXPECT_EQ(lanes[ThreadPool::NORMAL].Dispatched, 2u);
+    EXPECT_EQ(lanes[ThreadPool::BULK].Dispatched, 2u);
+    EXPECT_EQ(lanes[ThreadPool::BULK].Pending, 0u);
+    EXPECT_GE(lanes[ThreadPool::BULK].MaximumWait, lanes[ThreadPool::BULK].AverageWait);
+
+    threadPool.Stop();
+    gate.Release();
+}
@@ -0,0 +1,213 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <algorithm>
+#include <iostream>
+
+namespace WPEFramework {
+namespace Tests {
+
+    class PlainTimedEntry {
+    public:
+        PlainTimedEntry(const uint32_t id, std::atomic<uint32_t>& fired)
+            : _id(id)
+            , _fired(&fired)
+        {
+        }
+
+    public:
+        bool operator==(const PlainTimedEntry& RHS) const
+        {
+            return (_id == RHS._id);
+        }
+        bool operator!=(const PlainTimedEntry& RHS) const
+        {
+            return (!operator==(RHS));
+        }
+        uint64_t Timed(const uint64_t /* scheduledTime */)
+        {
+            (*_fired)++;
+            return (0);
+        }
+
+    protected:
+        uint32_t _id;
+        std::atomic<uint32_t>* _fired;
+    };
+
+    class HashedTimedEntry : public PlainTimedEntry {
+    public:
+        HashedTimedEntry(const uint32_t id, std::atomic<uint32_t>& fired)
+            : PlainTimedEntry(id, fired)
+        {
+        }
+
+    public:
+        size_t Hash() const
+        {
+            return (_id);
+        }
+    };
+
+    class OrderedEntry {
+    public:
+        OrderedEntry(const uint32_t id, std::vector<uint32_t>& order, std::atomic<uint32_t>& fired)
+            : _id(id)
+            , _order(&order)
+            , _fired(&fired)
+        {
+        }
+
+    public:
+        bool operator==(const OrderedEntry& RHS) const
+        {
+            return (_id == RHS._id);
+        }
+        bool operator!=(const OrderedEntry& RHS) const
+        {
+            return (!operator==(RHS));
+        }
+        size_t Hash() const
+        {
+            return (_id);
+        }
+        uint64_t Timed(const uint64_t /* scheduledTime */)
+        {
+            _order->push_back(_id);
+            (*_fired)++;
+            return (0);
+        }
+
+    private:
+        uint32_t _id;
+        std::vector<uint32_t>* _order;
+        std::atomic<uint32_t>* _fired;
+    };
+
+    static bool WaitForFired(const std::atomic<uint32_t>& fired, const uint32_t expected, const uint32_t waitTime)
+    {
+        uint64_t deadline = Core::Time::Now().Add(waitTime).Ticks();
+
+        while ((fired.load() < expected) && (Core::Time::Now().Ticks() < deadline)) {
+            SleepMs(1);
+        }
+
+        return (fired.load() == expected);
+    }
+
+    template <typename ENTRY>
+    static void TimerThroughput(const TCHAR* name, const uint32_t entries)
+    {
+        std::atomic<uint32_t> fired(0);
+        Core::TimerType<ENTRY> timer(Core::Thread::DefaultStackSize(), name);
+
+        // Park all entries an hour from now, in a scrambled order, so nothing fires while scheduling.
+        const uint64_t base = Core::Time::Now().Add(60 * 60 * 1000).Ticks();
+
+        uint64_t start = Core::Time::Now().Ticks();
+        for (uint32_t index = 0; index < entries; ++index) {
+            timer.Schedule(base + (((index * 7919) % entries) * Core::Time::TicksPerMillisecond), ENTRY(index, fired));
+        }
+        uint64_t scheduled = Core::Time::Now().Ticks();
+
+        EXPECT_EQ(timer.Pending(), entries);
+        EXPECT_TRUE(timer.HasEntry(ENTRY(entries - 1, fired)));
+        EXPECT_FALSE(timer.HasEntry(ENTRY(entries, fired)));
+
+        // Revoke every even entry...
+        uint32_t revoked = 0;
+        for (uint32_t index = 0; index < entries; index += 2) {
+            revoked += (timer.Revoke(ENTRY(index, fired)) == true ? 1 : 0);
+        }
+        uint64_t revokedTime = Core::Time::Now().Ticks();
+
+        EXPECT_EQ(revoked, (entries + 1) / 2);
+        EXPECT_EQ(timer.Pending(), entries - revoked);
+        EXPECT_FALSE(timer.Revoke(ENTRY(0, fired)));
+
+        // ...and pull all odd ones into the past, so they fire right away.
+        const uint64_t past = Core::Time::Now().Sub(1000).Ticks();
+        for (uint32_t index = 1; index < entries; index += 2) {
+            timer.Trigger(past, ENTRY(index, fired));
+        }
+
+        EXPECT_TRUE(WaitForFired(fired, entries - revoked, 10000));
+        uint64_t firedTime = Core::Time::Now().Ticks();
+
+        EXPECT_EQ(timer.Pending(), 0u);
+
+        auto rate = [](const uint32_t count, const uint64_t ticks) -> uint64_t {
+            return ((static_cast<uint64_t>(count) * Core::Time::TicksPerMillisecond * 1000) / std::max(ticks, static_cast<uint64_t>(1)));
+        };
+
+        std::cout << name << " [" << entries << " entries]: schedule " << rate(entries, scheduled - start)
+                  << "/s, revoke " << rate(revoked, revokedTime - scheduled)
+                  << "/s, trigger+fire " << rate(entries - revoked, firedTime - revokedTime) << "/s" << std::endl;
+    }
+
+    TEST(Core_TimerBenchmark, FiringOrder)
+    {
+        std::vector<uint32_t> order;
+        std::atomic<uint32_t> fired(0);
+        std::vector<std::pair<uint64_t, uint32_t>> expected;
+
+        Core::TimerType<OrderedEntry> timer(Core::Thread::DefaultStackSize(), _T("FiringOrder"));
+
+        const uint32_t entries = 1000;
+        const uint64_t base = Core::Time::Now().Add(200).Ticks();
+
+        // Scrambled schedule times, every time slot is used 4 times to check the insertion order of equal times.
+        for (uint32_t index = 0; index < entries; ++index) {
+            uint64_t time = base + ((index * 7919) % (entries / 4));
+            expected.emplace_back(time, index);
+            timer.Schedule(time, OrderedEntry(index, order, fired));
+        }
+
+        // Revoke a few, the remainder should still fire in order.
+        for (uint32_t index = 0; index < entries; index += 10) {
+            EXPECT_TRUE(timer.Revoke(OrderedEntry(index, order, fired)));
+        }
+        expected.erase(std::remove_if(expected.begin(), expected.end(),
+            [](const std::pair<uint64_t, uint32_t>& entry) { return ((entry.second % 10) == 0); }), expected.end());
+        std::stable_sort(expected.begin(), expected.end(),
+            [](const std::pair<uint64_t, uint32_t>& lhs, const std::pair<uint64_t, uint32_t>& rhs) { return (lhs.first < rhs.first); });
+
+        ASSERT_TRUE(WaitForFired(fired, static_cast<uint32_t>(expected.size()), 5000));
+        ASSERT_EQ(order.size(), expected.size());
+
+        for (uint32_t index = 0; index < order.size(); ++index) {
+            EXPECT_EQ(order[index], expected[index].second);
+        }
+    }
+
+    TEST(Core_TimerBenchmark, ThroughputHashed)
+    {
+        TimerThroughput<HashedTimedEntry>(_T("HashedTimer"), 16 * 1024);
+    }
+
+    TEST(Core_TimerBenchmark, ThroughputLinear)
+    {
+        TimerThroughput<PlainTimedEntry>(_T("LinearTimer"), 16 * 1024);
+    }
+} // Tests
+} // WPEFramework
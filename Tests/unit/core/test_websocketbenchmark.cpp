@@ -0,0 +1,127 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+#include <algorithm>
+#include <iostream>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // What the protocol used to do, byte by byte.
+    static uint8_t ReferenceMask(uint8_t data[], const uint32_t length, const uint8_t key[4], uint8_t phase)
+    {
+        for (uint32_t index = 0; index < length; index++) {
+            data[index] ^= key[phase];
+            phase = (phase + 1) & 0x03;
+        }
+        return (phase);
+    }
+
+    TEST(Core_WebSocketBenchmark, Mask)
+    {
+        const uint8_t key[4] = { 0x12, 0x34, 0x56, 0x78 };
+        uint8_t buffer[256];
+        uint8_t expected[256];
+
+        // Every alignment, length and phase, the wide paths should not make a difference.
+        for (uint8_t offset = 0; offset < 32; offset++) {
+            for (uint32_t length = 0; length < (sizeof(buffer) - 32); length += 7) {
+                for (uint8_t phase = 0; phase < 4; phase++) {
+                    for (uint32_t index = 0; index < sizeof(buffer); index++) {
+                        buffer[index] = expected[index] = static_cast<uint8_t>(index * 31);
+                    }
+
+                    EXPECT_EQ(Web::WebSocket::Protocol::Mask(&buffer[offset], length, key, phase), ReferenceMask(&expected[offset], length, key, phase));
+                    EXPECT_EQ(::memcmp(buffer, expected, sizeof(buffer)), 0);
+                }
+            }
+        }
+    }
+
+    TEST(Core_WebSocketBenchmark, MaskedFrames)
+    {
+        Web::WebSocket::Protocol client(true, true);
+        Web::WebSocket::Protocol server(true, false);
+        std::vector<uint8_t> frame(16 + 0xFFFF);
+
+        for (const uint16_t size : { 1, 5, 125, 126, 1000, 4099, 65000 }) {
+            for (uint16_t index = 0; index < size; index++) {
+                frame[4 + index] = static_cast<uint8_t>(index);
+            }
+
+            const uint16_t sent = client.Encoder(frame.data(), 0xFFFF, size);
+            EXPECT_EQ(sent, size + (size <= 125 ? 2 : 4) + 4);
+
+            // Hand the frame over in two parts, the second one continues with the right key byte.
+            uint16_t received = sent - (size / 3);
+            const uint16_t header = server.Decoder(frame.data(), received);
+            uint16_t rest = sent - header - received;
+
+            if (rest != 0) {
+                EXPECT_EQ(server.Decoder(&frame[header + received], rest), 0);
+                received += rest;
+            }
+
+            EXPECT_TRUE(server.IsCompleteMessage());
+            EXPECT_EQ(received, size);
+
+            for (uint16_t index = 0; index < size; index++) {
+                EXPECT_EQ(frame[header + index], static_cast<uint8_t>(index));
+            }
+        }
+    }
+
+    TEST(Core_WebSocketBenchmark, Throughput)
+    {
+        const uint8_t key[4] = { 0x12, 0x34, 0x56, 0x78 };
+        const uint32_t volume = 256 * 1024 * 1024;
+        std::vector<uint8_t> buffer(0xFFFF + 1);
+
+        auto rate = [](const uint64_t bytes, const uint64_t ticks) -> double {
+            return ((static_cast<double>(bytes) * Core::Time::TicksPerMillisecond * 1000) / (std::max(ticks, static_cast<uint64_t>(1)) * 1024.0 * 1024.0 * 1024.0));
+        };
+
+        for (const uint32_t size : { 64, 1024, 16384, 65535 }) {
+            const uint32_t rounds = volume / size;
+            uint8_t phase = 0;
+
+            // Start one byte off, received payloads follow a header of arbitrary size.
+            uint64_t start = Core::Time::Now().Ticks();
+            for (uint32_t round = 0; round < rounds; round++) {
+                phase = Web::WebSocket::Protocol::Mask(&buffer[1], size, key, phase);
+            }
+            uint64_t maskTime = Core::Time::Now().Ticks();
+            for (uint32_t round = 0; round < rounds; round++) {
+                phase = ReferenceMask(&buffer[1], size, key, phase);
+            }
+            uint64_t referenceTime = Core::Time::Now().Ticks();
+
+            const uint64_t bytes = static_cast<uint64_t>(rounds) * size;
+
+            std::cout << "Mask [" << size << " bytes]: " << rate(bytes, maskTime - start) << " GB/s, byte by byte "
+                      << rate(bytes, referenceTime - maskTime) << " GB/s" << std::endl;
+        }
+    }
+} // Tests
+} // WPEFramework
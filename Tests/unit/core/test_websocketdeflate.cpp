@@ -0,0 +1,191 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+#include <algorithm>
+#include <iostream>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // Stands in for the link, hands out a message in parts of the size asked for.
+    class MessageSource {
+    public:
+        MessageSource(const string& message)
+            : _message(message)
+            , _offset(0)
+        {
+        }
+
+        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
+        {
+            const uint16_t size = static_cast<uint16_t>(std::min(static_cast<size_t>(maxSendSize), _message.length() - _offset));
+
+            ::memcpy(dataFrame, &(_message[_offset]), size);
+            _offset += size;
+
+            return (size);
+        }
+
+    private:
+        string _message;
+        size_t _offset;
+    };
+
+    // Send a message from one side to the other, in frames of the given size.
+    static bool Transfer(Web::WebSocket::Deflate& sender, Web::WebSocket::Deflate& receiver, const string& message, const uint16_t frameSize, string& result)
+    {
+        MessageSource source(message);
+        std::vector<uint8_t> frame(frameSize);
+        bool completed = false;
+        uint16_t loaded;
+
+        do {
+            loaded = sender.Compress(frame.data(), frameSize, source);
+            completed = receiver.Decompress(frame.data(), loaded, (loaded < frameSize));
+        } while (loaded == frameSize);
+
+        if (completed == true) {
+            result = string(reinterpret_cast<const char*>(receiver.Message().data()), receiver.Message().size());
+            receiver.Message().clear();
+        }
+
+        return (completed);
+    }
+
+    TEST(WebSocket, DeflateNegotiation)
+    {
+        Web::WebSocket::Deflate::Settings settings;
+        Web::WebSocket::Deflate server;
+        string response;
+
+        // Not configured, nothing to agree on.
+        EXPECT_FALSE(server.Accept(_T("permessage-deflate"), response));
+        EXPECT_TRUE(response.empty());
+
+        settings.PeerWindowBits = 10;
+        server.Configure(settings);
+
+        EXPECT_TRUE(server.Accept(_T("permessage-deflate"), response));
+        EXPECT_STREQ(response.c_str(), _T("permessage-deflate"));
+
+        // Only if the client allows, the window for what it sends is limited.
+        EXPECT_TRUE(server.Accept(_T("permessage-deflate; client_max_window_bits"), response));
+        EXPECT_STREQ(response.c_str(), _T("permessage-deflate; client_max_window_bits=10"));
+
+        EXPECT_TRUE(server.Accept(_T("permessage-deflate; server_no_context_takeover; server_max_window_bits=12"), response));
+        EXPECT_STREQ(response.c_str(), _T("permessage-deflate; server_no_context_takeover; server_max_window_bits=12"));
+
+        // Offers we can not live with are skipped, the next one is taken.
+        EXPECT_TRUE(server.Accept(_T("permessage-deflate; server_max_window_bits=8, permessage-deflate; unknown, permessage-deflate; client_no_context_takeover"), response));
+        EXPECT_STREQ(response.c_str(), _T("permessage-deflate; client_no_context_takeover"));
+
+        EXPECT_FALSE(server.Accept(_T("x-webkit-deflate-frame, permessage-deflate; server_max_window_bits=16"), response));
+        EXPECT_FALSE(server.IsActive());
+
+        Web::WebSocket::Deflate client;
+        settings.ContextTakeover = false;
+        client.Configure(settings);
+
+        EXPECT_STREQ(client.Offer().c_str(), _T("permessage-deflate; client_max_window_bits; client_no_context_takeover; server_max_window_bits=10"));
+        EXPECT_TRUE(client.Agree(_T("permessage-deflate; server_max_window_bits=10; client_max_window_bits=12")));
+        EXPECT_TRUE(client.IsCompressing());
+
+        // A window we can not deflate with, we receive compressed messages but send them as they are.
+        EXPECT_TRUE(client.Agree(_T("permessage-deflate; client_max_window_bits=8")));
+        EXPECT_TRUE(client.IsActive());
+        EXPECT_FALSE(client.IsCompressing());
+
+        EXPECT_FALSE(client.Agree(_T("permessage-deflate; unknown")));
+        EXPECT_FALSE(client.Agree(_T("x-webkit-deflate-frame")));
+        EXPECT_FALSE(client.IsActive());
+    }
+
+    TEST(WebSocket, DeflateMessages)
+    {
+        Web::WebSocket::Deflate::Settings settings;
+        Web::WebSocket::Deflate server;
+        Web::WebSocket::Deflate client;
+        string response;
+
+        settings.MaxMessageSize = 64 * 1024;
+        server.Configure(settings);
+        client.Configure(settings);
+
+        EXPECT_TRUE(server.Accept(client.Offer(), response));
+        EXPECT_TRUE(client.Agree(response));
+
+        string event(_T("{\"jsonrpc\":\"2.0\",\"method\":\"client.events.statechange\",\"params\":{\"callsign\":\"WebKitBrowser\",\"state\":\"Activated\"}}"));
+        string large;
+        while (large.length() < 20000) {
+            large += event;
+        }
+
+        // Whatever the frame size, what comes out is what went in.
+        for (const uint16_t frameSize : { 1, 7, 64, 1024, 8192 }) {
+            for (const string& message : { event, large }) {
+                string result;
+
+                EXPECT_TRUE(Transfer(server, client, message, frameSize, result));
+                EXPECT_EQ(result, message);
+                EXPECT_TRUE(Transfer(client, server, message, frameSize, result));
+                EXPECT_EQ(result, message);
+            }
+        }
+
+        // An empty message comes as a single empty block or without any payload at all.
+        const uint8_t empty[] = { 0x00 };
+        EXPECT_TRUE(client.Decompress(empty, sizeof(empty), true));
+        EXPECT_TRUE(client.Message().empty());
+        EXPECT_TRUE(client.Decompress(nullptr, 0, true));
+        EXPECT_TRUE(client.Message().empty());
+
+        // The dictionary is kept, the same event again is only a few bytes.
+        const Web::WebSocket::Deflate::Statistics before(server.Counters());
+        string result;
+        EXPECT_TRUE(Transfer(server, client, event, 1024, result));
+        EXPECT_LT(server.Counters().Deflated - before.Deflated, 16u);
+
+        // Too big for the receiver, the message is dropped, the next one comes through.
+        string huge;
+        while (huge.length() < (2 * settings.MaxMessageSize)) {
+            huge += large;
+        }
+        EXPECT_FALSE(Transfer(server, client, huge, 4096, result));
+        EXPECT_EQ(client.Counters().Dropped, 1u);
+
+        Web::WebSocket::Deflate fresh;
+        fresh.Configure(settings);
+        EXPECT_TRUE(fresh.Agree(response));
+        EXPECT_TRUE(Transfer(fresh, client, event, 1024, result));
+        EXPECT_EQ(result, event);
+
+        const Web::WebSocket::Deflate::Statistics& counters(server.Counters());
+        EXPECT_GT(counters.Sent, 0u);
+        EXPECT_LT(counters.Deflated, counters.Plain);
+
+        std::cout << "Deflate: " << counters.Sent << " messages, " << counters.Plain << " -> " << counters.Deflated << " bytes ("
+                  << ((counters.Deflated * 100) / counters.Plain) << "%) in " << counters.DeflateTime << " uS" << std::endl;
+    }
+} // Tests
+} // WPEFramework
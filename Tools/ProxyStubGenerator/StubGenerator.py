@@ -458,6 +458,19 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                                      or self.type.IsPointer())
                     self.is_output = True
 
+            # What a value takes in the frame, as a C++ expression
+            def SizeHint(rpctype, value, length=None):
+                if rpctype.startswith("Number<"):
+                    return "sizeof(%s)" % rpctype[7:-1]
+                elif rpctype == "Boolean":
+                    return "1"
+                elif rpctype == "Text":
+                    return "RPC::Data::Frame::TextSize(%s)" % value
+                elif rpctype.startswith("Buffer<") and length:
+                    return "RPC::Data::Frame::BufferSize<%s>(%s)" % (rpctype[7:-1], length)
+                else:
+                    return None
+
             # Stringify a method object to full signature
             def SignatureStr(method, parameters=None):
                 return Strip(str(method))
@@ -749,6 +762,11 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                             emit.Line("// allocate receive buffer")
                                         emit.Line("%s %s{};" % (p.str_nocvref, p.name))
                                         length_var = p.maxlength_var if p.maxlength_var else p.length_var
+                                        # buffers with a wider length may well be larger than the stack can take, these
+                                        # go on the heap (and are handed over in bulk by the frame)
+                                        on_heap = p.length_type not in ["char", "short", "int8_t", "uint8_t", "int16_t", "uint16_t"]
+                                        if on_heap and (not p.is_input or p.maxlength_var):
+                                            emit.Line("std::vector<uint8_t> %s_storage;" % p.name)
                                         if p.length_constant:
                                             emit.Line("const %s %s = %s;" %
                                                       (p.length_type, p.length_var, p.length_expr))
@@ -758,13 +776,13 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                                 emit.Line("%s = const_cast<%s>(%s);" % (p.name, p.str_nocvref, oldname))
                                                 emit.Line("if (%s > %s) {" % (p.maxlength_var, p.length_var))
                                                 emit.IndentInc()
-                                                if p.length_type not in [
-                                                        "char", "short", "int8_t", "uint8_t", "int16_t", "uint16_t"
-                                                ]:
-                                                    emit.Line("ASSERT((%s < 0x10000) && \"Buffer too large\");" %
-                                                              length_var)
-                                                emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
-                                                          (p.name, p.str_nocvref, length_var))
+                                                if on_heap:
+                                                    emit.Line("%s_storage.resize(%s);" % (p.name, length_var))
+                                                    emit.Line("%s = reinterpret_cast<%s>(%s_storage.data());" %
+                                                              (p.name, p.str_nocvref, p.name))
+                                                else:
+                                                    emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
+                                                              (p.name, p.str_nocvref, length_var))
                                                 emit.Line("ASSERT(%s != %s);" % (p.name, NULLPTR))
                                             else:
                                                 # is input/output but maxlength not defined
@@ -775,13 +793,13 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                             if not p.length_constant:
                                                 emit.Line("if (%s != 0) {" % p.length_var)
                                                 emit.IndentInc()
-                                            if p.length_type not in [
-                                                    "char", "short", "int8_t", "uint8_t", "int16_t", "uint16_t"
-                                            ]:
-                                                emit.Line("ASSERT((%s < 0x10000) && \"Buffer length too big\");" %
-                                                          length_var)
-                                            emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
-                                                      (p.name, p.str_nocvref, length_var))
+                                            if on_heap:
+                                                emit.Line("%s_storage.resize(%s);" % (p.name, length_var))
+                                                emit.Line("%s = reinterpret_cast<%s>(%s_storage.data());" %
+                                                          (p.name, p.str_nocvref, p.name))
+                                            else:
+                                                emit.Line("%s = static_cast<%s>(ALLOCA(%s));" %
+                                                          (p.name, p.str_nocvref, length_var))
                                             emit.Line("ASSERT(%s != %s);" % (p.name, NULLPTR))
                                             if not p.length_constant:
                                                 emit.IndentDec()
@@ -1041,17 +1059,17 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                     emit.Line()
 
                     if input_params:
-                        emit.Line("// write parameters")
-                        emit.Line("RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());")
+                        writes = []
 
                         for c, p in enumerate(params):
                             if not p.is_ptr and not p.CheckRpcType():
                                 if p.obj:
                                     if p.obj.vars:
-                                        emit.Line("// (decompose %s)" % p.str_typename)
+                                        writes.append(("// (decompose %s)" % p.str_typename, None))
                                         for attr in p.obj.vars:
-                                            emit.Line("writer.%s(param%i.%s);" %
-                                                      (EmitParam(attr).RpcTypeNoCV(), c, attr.name))
+                                            value = "param%i.%s" % (c, attr.name)
+                                            writes.append(("writer.%s(%s);" % (EmitParam(attr).RpcTypeNoCV(), value),
+                                                           SizeHint(EmitParam(attr).RpcTypeNoCV(), value)))
                                     else:
                                         raise TypenameError(
                                             m, "method '%s': unable to decompose parameter '%s': non-POD type" %
@@ -1065,16 +1083,28 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                     proxy_params += 1
                                 if not p.obj and p.is_ptr:
                                     if p.is_input:
-                                        emit.Line("writer.%s(%s, param%i);" % (p.RpcType(), p.length_expr, c))
+                                        writes.append(("writer.%s(%s, param%i);" % (p.RpcType(), p.length_expr, c),
+                                                       SizeHint(p.RpcType(), "param%i" % c, p.length_expr)))
                                 elif not p.is_input and ((p.is_nonconstref and p.is_nonconstptr) or p.is_ptr_ptr):
                                     pass
                                 elif (not p.is_length or not params[p.length_target].is_input
                                       or p.is_maxlength) and (p.is_input or
                                                               (not p.is_nonconstref and not p.is_nonconstptr) or p.obj):
                                     if p.proxy:
-                                        emit.Line("writer.%s(RPC::instance_cast<%s>(param%i));" % (p.RpcType(), p.CppType(), c))
+                                        writes.append(("writer.%s(RPC::instance_cast<%s>(param%i));" % (p.RpcType(), p.CppType(), c),
+                                                       SizeHint(p.RpcType(), "param%i" % c)))
                                     else:
-                                        emit.Line("writer.%s(param%i);" % (p.RpcType(), c))
+                                        writes.append(("writer.%s(param%i);" % (p.RpcType(), c),
+                                                       SizeHint(p.RpcType(), "param%i" % c)))
+
+                        emit.Line("// write parameters")
+                        hints = [hint for _, hint in writes if hint]
+                        if hints:
+                            # size the (pooled) frame up front, so it does not grow while it is written
+                            emit.Line("newMessage->Parameters().Reserve(%s);" % " + ".join(hints))
+                        emit.Line("RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());")
+                        for line, _ in writes:
+                            emit.Line(line)
                         emit.Line()
 
                     for c, p in enumerate(params):